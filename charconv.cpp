@@ -24,162 +24,485 @@
 
 #include "charconv.hpp"
 
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace charconv {
 // Constructor: Set the initial codepage
 CharConverter::CharConverter(uint16_t codepage) {
     translationTable = getTranslationTable(codepage);
 }
 
-// Method to convert a string from the current codepage to UTF-8
-void CharConverter::convert(const char* input, char* utf8TextPtr, size_t bufferSize) const {
+// Method to convert a string from the current codepage to UTF-8 into the given buffer
+size_t CharConverter::convert(const char* input, char* utf8TextPtr, size_t bufferSize) const {
+    if (!utf8TextPtr) {
+        return write(input, NULL, 0);
+    }
+    if (bufferSize == 0) {
+        throw std::out_of_range("convert buffer is not large enough");
+    }
+
+    // Keep one byte for the terminating NUL
+    size_t length = write(input, utf8TextPtr, bufferSize - 1);
+    utf8TextPtr[length] = '\0';
+    return length;
+}
+
+// Method to append the UTF-8 conversion of a string to the given string
+void CharConverter::convert(const char* input, std::string& utf8Text) const {
+    size_t length = write(input, NULL, 0);
+    if (length == 0) {
+        return;
+    }
+
+    size_t offset = utf8Text.size();
+    utf8Text.resize(offset + length);
+    write(input, &utf8Text[offset], length);
+}
+
+// Method to append the UTF-8 conversion of a string to the given byte vector
+void CharConverter::convert(const char* input, std::vector<uint8_t>& utf8Bytes) const {
+    size_t length = write(input, NULL, 0);
+    if (length == 0) {
+        return;
+    }
+
+    size_t offset = utf8Bytes.size();
+    utf8Bytes.resize(offset + length);
+    write(input, reinterpret_cast<char*>(&utf8Bytes[offset]), length);
+}
+
+// Helper method to write the UTF-8 conversion straight into the output, without a terminating NUL
+size_t CharConverter::write(const char* input, char* output, size_t outputSize) const {
     if (!input) {
         throw std::invalid_argument("convert input can not be null");
     }
 
-    std::string utf8Text;
+    size_t inputSize = std::strlen(input);
+    size_t consumed;
+    size_t length = convertChunk(input, inputSize, output, outputSize, consumed);
+
+    if (consumed < inputSize) {
+        throw std::out_of_range("convert buffer is not large enough");
+    }
+    return length;
+}
+
+// Method to convert a chunk of input into the given output window
+size_t CharConverter::convertChunk(const char* input, size_t inputSize, char* output, size_t outputSize,
+                                   size_t& consumed) const {
+    size_t length = 0;
+
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(input);
+    const unsigned char* end = p + inputSize;
 
-    for (const char* p = input; *p; ++p) {
-        unsigned char ch = static_cast<unsigned char>(*p);
-        bool isAscii = (ch < 0x80);
+    while (p < end) {
+        // Copy the run of ASCII characters in one go
+        size_t run = asciiRunLength(p, static_cast<size_t>(end - p));
+        if (run > 0) {
+            if (output) {
+                if (length + run > outputSize) {
+                    run = outputSize - length;
+                }
+                std::memcpy(output + length, p, run);
+            }
+            length += run;
+            p += run;
 
-        if (isAscii)
-            utf8Text += ch;
-        else {
-            // Subtract 0x80 to get the index for the translation table
-            utf8Text += translationTable[ch - 0x80];
+            if (p == end || (output && length == outputSize)) {
+                break;
+            }
         }
+
+        // Subtract 0x80 to get the index for the translation table
+        const uint8_t* entry = translationTable[*p - 0x80];
+        size_t utf8Length = entry[0];
+
+        if (output) {
+            if (length + 3 <= outputSize) {
+                // Fixed size store, bytes past the sequence are overwritten by the next character
+                std::memcpy(output + length, entry + 1, 3);
+            } else if (length + utf8Length <= outputSize) {
+                std::memcpy(output + length, entry + 1, utf8Length);
+            } else {
+                break;  // Does not fit into the output window
+            }
+        }
+        length += utf8Length;
+        p++;
     }
 
-    // Ensure the buffer is large enough
-    if (utf8Text.size() + 1 > bufferSize) {
-        throw std::out_of_range("convert buffer is not large enough");
+    consumed = static_cast<size_t>(p - reinterpret_cast<const unsigned char*>(input));
+    return length;
+}
+
+// Helper method to count the ASCII characters at the start of the input. Checks two machine
+// words at a time for bytes with the high bit set (4 bytes on 16 bit DOS, 16 bytes on 64 bit
+// hosts), or whole SSE2 registers where available, before looking at single bytes.
+size_t CharConverter::asciiRunLength(const unsigned char* input, size_t length) {
+    size_t run = 0;
+
+#if defined(__SSE2__)
+    while (length - run >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + run));
+        if (_mm_movemask_epi8(chunk) != 0) {
+            break;
+        }
+        run += 16;
+    }
+#endif
+
+    const size_t highBits = static_cast<size_t>(-1) / 0xFF * 0x80;  // 0x8080...80
+    while (length - run >= 2 * sizeof(size_t)) {
+        size_t word0;
+        size_t word1;
+        std::memcpy(&word0, input + run, sizeof(size_t));
+        std::memcpy(&word1, input + run + sizeof(size_t), sizeof(size_t));
+        if ((word0 | word1) & highBits) {
+            break;
+        }
+        run += 2 * sizeof(size_t);
     }
 
-    // Copy the UTF-8 string into the provided buffer
-    std::strcpy(utf8TextPtr, utf8Text.c_str());
-    return;
+    while (run < length && input[run] < 0x80) {
+        run++;
+    }
+
+    return run;
+}
+
+// Constructor: Set the converter for the input codepage
+StreamConverter::StreamConverter(const CharConverter& converter) : converter(converter) {
+    reset();
+}
+
+// Method to convert as much of the input chunk as fits into the output window
+void StreamConverter::convert(const char* input, size_t inputSize, char* output, size_t outputSize, size_t& consumed,
+                              size_t& produced) {
+    consumed = 0;
+    produced = 0;
+
+    // Finish a sequence split by the last call first
+    while (pendingStart < pendingEnd && produced < outputSize) {
+        output[produced++] = pending[pendingStart++];
+    }
+
+    if (pendingStart == pendingEnd && inputSize > 0) {
+        produced += converter.convertChunk(input, inputSize, output + produced, outputSize - produced, consumed);
+
+        // Split the next character if it does not fit completely into the rest of the window
+        if (consumed < inputSize && produced < outputSize) {
+            size_t used;
+            pendingStart = 0;
+            pendingEnd = converter.convertChunk(input + consumed, 1, pending, sizeof(pending), used);
+            consumed += used;
+
+            while (pendingStart < pendingEnd && produced < outputSize) {
+                output[produced++] = pending[pendingStart++];
+            }
+        }
+    }
+
+    totalConsumed += consumed;
+    totalProduced += produced;
+}
+
+// Method to check if bytes of a split UTF-8 sequence are waiting for the next output window
+bool StreamConverter::hasPending() const {
+    return pendingStart < pendingEnd;
+}
+
+// Method to get the number of bytes consumed since construction or reset
+unsigned long StreamConverter::getTotalConsumed() const {
+    return totalConsumed;
+}
+
+// Method to get the number of bytes produced since construction or reset
+unsigned long StreamConverter::getTotalProduced() const {
+    return totalProduced;
+}
+
+// Method to drop pending bytes and reset the counters
+void StreamConverter::reset() {
+    pendingStart = 0;
+    pendingEnd = 0;
+    totalConsumed = 0;
+    totalProduced = 0;
+}
+
+// Method to translate a string into the first ECI charset that has all of its characters
+long CharConverter::convertToEci(const char* input, std::vector<uint8_t>& output) const {
+    // Find the distinct non ASCII characters first, so each is looked up only once per charset
+    bool used[128] = {false};
+    size_t length = 0;
+    for (const unsigned char* p = reinterpret_cast<const unsigned char*>(input); *p != '\0'; p++, length++) {
+        if (*p >= 0x80) {
+            used[*p - 0x80] = true;
+        }
+    }
+
+    for (size_t i = 0; i < numEciCharsets; i++) {
+        uint8_t mapping[128];
+        if (!getEciMapping(eciCharsets[i].table, used, mapping)) {
+            continue;
+        }
+
+        output.resize(length);
+        for (size_t j = 0; j < length; j++) {
+            uint8_t ch = static_cast<uint8_t>(input[j]);
+            output[j] = ch < 0x80 ? ch : mapping[ch - 0x80];
+        }
+        return eciCharsets[i].assignment;
+    }
+    return -1;
+}
+
+// Helper method to find the bytes of the used characters in the given table, returns false if one is missing
+bool CharConverter::getEciMapping(const Utf8Entry* table, const bool used[128], uint8_t mapping[128]) const {
+    for (int i = 0; i < 128; i++) {
+        if (!used[i]) {
+            continue;
+        }
+        const Utf8Entry& entry = translationTable[i];
+        int j = 0;
+        while (j < 128 && (table[j][0] == 0 || std::memcmp(table[j], entry, 1 + entry[0]) != 0)) {
+            j++;
+        }
+        if (j == 128) {
+            return false;
+        }
+        mapping[i] = static_cast<uint8_t>(0x80 + j);
+    }
+    return true;
 }
 
 // Helper method to select the translation table based on the codepage,
 // defaulting to CP437 if the codepage is not recognized
-const char** CharConverter::getTranslationTable(uint16_t codepage) const {
-    switch (codepage) {
-        case 858:
-            return cp858_to_utf8;
-        case 850:
-            return cp850_to_utf8;
-        case 852:
-            return cp852_to_utf8;
-        case 866:
-            return cp866_to_utf8;
-        case 737:
-            return cp737_to_utf8;
-        default:
-            return cp437_to_utf8;
+const CharConverter::Utf8Entry* CharConverter::getTranslationTable(uint16_t codepage) const {
+    for (size_t i = 0; i < numCodepages; i++) {
+        if (codepages[i].codepage == codepage) {
+            return codepages[i].table;
+        }
     }
+    return codepages[0].table;
 }
 
+// New codepages only need a translation table below and an entry in this list
+const CharConverter::Codepage CharConverter::codepages[] = {
+    {437, cp437_to_utf8},
+    {850, cp850_to_utf8},
+    {852, cp852_to_utf8},
+    {858, cp858_to_utf8},
+    {866, cp866_to_utf8},
+    {737, cp737_to_utf8},
+};
+
+const size_t CharConverter::numCodepages = sizeof(codepages) / sizeof(codepages[0]);
+
+// Single byte charsets for convertToEci in order of preference, ISO 8859 is read by more decoders than CP437
+const CharConverter::EciCharset CharConverter::eciCharsets[] = {
+    {3, iso8859_1_to_utf8},
+    {4, iso8859_2_to_utf8},
+    {7, iso8859_5_to_utf8},
+    {9, iso8859_7_to_utf8},
+    {2, cp437_to_utf8},
+};
+
+const size_t CharConverter::numEciCharsets = sizeof(eciCharsets) / sizeof(eciCharsets[0]);
+
 // clang-format off
-const char* CharConverter::cp858_to_utf8[128] = {
-    /* 0x80 */ "\xC3\x87", /* 0x81 */ "\xC3\xBC", /* 0x82 */ "\xC3\xA9", /* 0x83 */ "\xC3\xA2", /* 0x84 */ "\xC3\xA4", /* 0x85 */ "\xC3\xA0", /* 0x86 */ "\xC3\xA5", /* 0x87 */ "\xC3\xA7", /* 0x88 */ "\xC3\xAA", /* 0x89 */ "\xC3\xAB",
-    /* 0x8A */ "\xC3\xA8", /* 0x8B */ "\xC3\xAF", /* 0x8C */ "\xC3\xAE", /* 0x8D */ "\xC3\xAC", /* 0x8E */ "\xC3\x84", /* 0x8F */ "\xC3\x85", /* 0x90 */ "\xC3\x89", /* 0x91 */ "\xC3\xA6", /* 0x92 */ "\xC3\x86", /* 0x93 */ "\xC3\xB4",
-    /* 0x94 */ "\xC3\xB6", /* 0x95 */ "\xC3\xB2", /* 0x96 */ "\xC3\xBB", /* 0x97 */ "\xC3\xB9", /* 0x98 */ "\xC3\xBF", /* 0x99 */ "\xC3\x96", /* 0x9A */ "\xC3\x9C", /* 0x9B */ "\xC3\xB8", /* 0x9C */ "\xC2\xA3", /* 0x9D */ "\xC3\x98",
-    /* 0x9E */ "\xC3\x97", /* 0x9F */ "\xC6\x92", /* 0xA0 */ "\xC3\xA1", /* 0xA1 */ "\xC3\xAD", /* 0xA2 */ "\xC3\xB3", /* 0xA3 */ "\xC3\xBA", /* 0xA4 */ "\xC3\xB1", /* 0xA5 */ "\xC3\x91", /* 0xA6 */ "\xC2\xAA", /* 0xA7 */ "\xC2\xBA",
-    /* 0xA8 */ "\xC2\xBF", /* 0xA9 */ "\xC2\xAE", /* 0xAA */ "\xC2\xAC", /* 0xAB */ "\xC2\xBD", /* 0xAC */ "\xC2\xBC", /* 0xAD */ "\xC2\xA1", /* 0xAE */ "\xC2\xAB", /* 0xAF */ "\xC2\xBB", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xC3\x81", /* 0xB6 */ "\xC3\x82", /* 0xB7 */ "\xC3\x80", /* 0xB8 */ "\xC2\xA9", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xC2\xA2", /* 0xBE */ "\xC2\xA5", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xC3\xA3", /* 0xC7 */ "\xC3\x83", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xC2\xA4", /* 0xD0 */ "\xC3\xB0", /* 0xD1 */ "\xC3\x90", /* 0xD2 */ "\xC3\x8A", /* 0xD3 */ "\xC3\x8B", /* 0xD4 */ "\xC3\x88", /* 0xD5 */ "\xE2\x82\xAC", /* 0xD6 */ "\xC3\x8D",
-    /* 0xD7 */ "\xC3\x8E", /* 0xD8 */ "\xC3\x8F", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xC2\xA6", /* 0xDE */ "\xC3\x8C", /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xC3\x93",
-    /* 0xE1 */ "\xC3\x9F", /* 0xE2 */ "\xC3\x94", /* 0xE3 */ "\xC3\x92", /* 0xE4 */ "\xC3\xB5", /* 0xE5 */ "\xC3\x95", /* 0xE6 */ "\xC2\xB5", /* 0xE7 */ "\xC3\xBE", /* 0xE8 */ "\xC3\x9E", /* 0xE9 */ "\xC3\x9A", /* 0xEA */ "\xC3\x9B",
-    /* 0xEB */ "\xC3\x99", /* 0xEC */ "\xC3\xBD", /* 0xED */ "\xC3\x9D", /* 0xEE */ "\xC2\xAF", /* 0xEF */ "\xC2\xB4", /* 0xF0 */ "\xC2\xAD", /* 0xF1 */ "\xC2\xB1", /* 0xF2 */ "\xE2\x80\x97", /* 0xF3 */ "\xC2\xBE", /* 0xF4 */ "\xC2\xB6",
-    /* 0xF5 */ "\xC2\xA7", /* 0xF6 */ "\xC3\xB7", /* 0xF7 */ "\xC2\xB8", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xC2\xA8", /* 0xFA */ "\xC2\xB7", /* 0xFB */ "\xC2\xB9", /* 0xFC */ "\xC2\xB3", /* 0xFD */ "\xC2\xB2", /* 0xFE */ "\xE2\x96\xA0",
-    /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::cp858_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xC3, 0x87, 0x00}, /* 0x81 */ {0x02, 0xC3, 0xBC, 0x00}, /* 0x82 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0x83 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0x84 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0x85 */ {0x02, 0xC3, 0xA0, 0x00}, /* 0x86 */ {0x02, 0xC3, 0xA5, 0x00}, /* 0x87 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0x88 */ {0x02, 0xC3, 0xAA, 0x00}, /* 0x89 */ {0x02, 0xC3, 0xAB, 0x00}, /* 0x8A */ {0x02, 0xC3, 0xA8, 0x00}, /* 0x8B */ {0x02, 0xC3, 0xAF, 0x00}, /* 0x8C */ {0x02, 0xC3, 0xAE, 0x00}, /* 0x8D */ {0x02, 0xC3, 0xAC, 0x00}, /* 0x8E */ {0x02, 0xC3, 0x84, 0x00}, /* 0x8F */ {0x02, 0xC3, 0x85, 0x00},
+    /* 0x90 */ {0x02, 0xC3, 0x89, 0x00}, /* 0x91 */ {0x02, 0xC3, 0xA6, 0x00}, /* 0x92 */ {0x02, 0xC3, 0x86, 0x00}, /* 0x93 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0x94 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0x95 */ {0x02, 0xC3, 0xB2, 0x00}, /* 0x96 */ {0x02, 0xC3, 0xBB, 0x00}, /* 0x97 */ {0x02, 0xC3, 0xB9, 0x00},
+    /* 0x98 */ {0x02, 0xC3, 0xBF, 0x00}, /* 0x99 */ {0x02, 0xC3, 0x96, 0x00}, /* 0x9A */ {0x02, 0xC3, 0x9C, 0x00}, /* 0x9B */ {0x02, 0xC3, 0xB8, 0x00}, /* 0x9C */ {0x02, 0xC2, 0xA3, 0x00}, /* 0x9D */ {0x02, 0xC3, 0x98, 0x00}, /* 0x9E */ {0x02, 0xC3, 0x97, 0x00}, /* 0x9F */ {0x02, 0xC6, 0x92, 0x00},
+    /* 0xA0 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xA1 */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xA2 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xA3 */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xA4 */ {0x02, 0xC3, 0xB1, 0x00}, /* 0xA5 */ {0x02, 0xC3, 0x91, 0x00}, /* 0xA6 */ {0x02, 0xC2, 0xAA, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xBA, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xBF, 0x00}, /* 0xA9 */ {0x02, 0xC2, 0xAE, 0x00}, /* 0xAA */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAB */ {0x02, 0xC2, 0xBD, 0x00}, /* 0xAC */ {0x02, 0xC2, 0xBC, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xA1, 0x00}, /* 0xAE */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAF */ {0x02, 0xC2, 0xBB, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x02, 0xC3, 0x81, 0x00}, /* 0xB6 */ {0x02, 0xC3, 0x82, 0x00}, /* 0xB7 */ {0x02, 0xC3, 0x80, 0x00},
+    /* 0xB8 */ {0x02, 0xC2, 0xA9, 0x00}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x02, 0xC2, 0xA2, 0x00}, /* 0xBE */ {0x02, 0xC2, 0xA5, 0x00}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x02, 0xC3, 0xA3, 0x00}, /* 0xC7 */ {0x02, 0xC3, 0x83, 0x00},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x02, 0xC2, 0xA4, 0x00},
+    /* 0xD0 */ {0x02, 0xC3, 0xB0, 0x00}, /* 0xD1 */ {0x02, 0xC3, 0x90, 0x00}, /* 0xD2 */ {0x02, 0xC3, 0x8A, 0x00}, /* 0xD3 */ {0x02, 0xC3, 0x8B, 0x00}, /* 0xD4 */ {0x02, 0xC3, 0x88, 0x00}, /* 0xD5 */ {0x03, 0xE2, 0x82, 0xAC}, /* 0xD6 */ {0x02, 0xC3, 0x8D, 0x00}, /* 0xD7 */ {0x02, 0xC3, 0x8E, 0x00},
+    /* 0xD8 */ {0x02, 0xC3, 0x8F, 0x00}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x02, 0xC2, 0xA6, 0x00}, /* 0xDE */ {0x02, 0xC3, 0x8C, 0x00}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xC3, 0x93, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0x9F, 0x00}, /* 0xE2 */ {0x02, 0xC3, 0x94, 0x00}, /* 0xE3 */ {0x02, 0xC3, 0x92, 0x00}, /* 0xE4 */ {0x02, 0xC3, 0xB5, 0x00}, /* 0xE5 */ {0x02, 0xC3, 0x95, 0x00}, /* 0xE6 */ {0x02, 0xC2, 0xB5, 0x00}, /* 0xE7 */ {0x02, 0xC3, 0xBE, 0x00},
+    /* 0xE8 */ {0x02, 0xC3, 0x9E, 0x00}, /* 0xE9 */ {0x02, 0xC3, 0x9A, 0x00}, /* 0xEA */ {0x02, 0xC3, 0x9B, 0x00}, /* 0xEB */ {0x02, 0xC3, 0x99, 0x00}, /* 0xEC */ {0x02, 0xC3, 0xBD, 0x00}, /* 0xED */ {0x02, 0xC3, 0x9D, 0x00}, /* 0xEE */ {0x02, 0xC2, 0xAF, 0x00}, /* 0xEF */ {0x02, 0xC2, 0xB4, 0x00},
+    /* 0xF0 */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xF1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xF2 */ {0x03, 0xE2, 0x80, 0x97}, /* 0xF3 */ {0x02, 0xC2, 0xBE, 0x00}, /* 0xF4 */ {0x02, 0xC2, 0xB6, 0x00}, /* 0xF5 */ {0x02, 0xC2, 0xA7, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB7, 0x00}, /* 0xF7 */ {0x02, 0xC2, 0xB8, 0x00},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xFA */ {0x02, 0xC2, 0xB7, 0x00}, /* 0xFB */ {0x02, 0xC2, 0xB9, 0x00}, /* 0xFC */ {0x02, 0xC2, 0xB3, 0x00}, /* 0xFD */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
+};
+
+const CharConverter::Utf8Entry CharConverter::cp850_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xC3, 0x87, 0x00}, /* 0x81 */ {0x02, 0xC3, 0xBC, 0x00}, /* 0x82 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0x83 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0x84 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0x85 */ {0x02, 0xC3, 0xA0, 0x00}, /* 0x86 */ {0x02, 0xC3, 0xA5, 0x00}, /* 0x87 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0x88 */ {0x02, 0xC3, 0xAA, 0x00}, /* 0x89 */ {0x02, 0xC3, 0xAB, 0x00}, /* 0x8A */ {0x02, 0xC3, 0xA8, 0x00}, /* 0x8B */ {0x02, 0xC3, 0xAF, 0x00}, /* 0x8C */ {0x02, 0xC3, 0xAE, 0x00}, /* 0x8D */ {0x02, 0xC3, 0xAC, 0x00}, /* 0x8E */ {0x02, 0xC3, 0x84, 0x00}, /* 0x8F */ {0x02, 0xC3, 0x85, 0x00},
+    /* 0x90 */ {0x02, 0xC3, 0x89, 0x00}, /* 0x91 */ {0x02, 0xC3, 0xA6, 0x00}, /* 0x92 */ {0x02, 0xC3, 0x86, 0x00}, /* 0x93 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0x94 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0x95 */ {0x02, 0xC3, 0xB2, 0x00}, /* 0x96 */ {0x02, 0xC3, 0xBB, 0x00}, /* 0x97 */ {0x02, 0xC3, 0xB9, 0x00},
+    /* 0x98 */ {0x02, 0xC3, 0xBF, 0x00}, /* 0x99 */ {0x02, 0xC3, 0x96, 0x00}, /* 0x9A */ {0x02, 0xC3, 0x9C, 0x00}, /* 0x9B */ {0x02, 0xC3, 0xB8, 0x00}, /* 0x9C */ {0x02, 0xC2, 0xA3, 0x00}, /* 0x9D */ {0x02, 0xC3, 0x98, 0x00}, /* 0x9E */ {0x02, 0xC3, 0x97, 0x00}, /* 0x9F */ {0x02, 0xC6, 0x92, 0x00},
+    /* 0xA0 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xA1 */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xA2 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xA3 */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xA4 */ {0x02, 0xC3, 0xB1, 0x00}, /* 0xA5 */ {0x02, 0xC3, 0x91, 0x00}, /* 0xA6 */ {0x02, 0xC2, 0xAA, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xBA, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xBF, 0x00}, /* 0xA9 */ {0x02, 0xC2, 0xAE, 0x00}, /* 0xAA */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAB */ {0x02, 0xC2, 0xBD, 0x00}, /* 0xAC */ {0x02, 0xC2, 0xBC, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xA1, 0x00}, /* 0xAE */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAF */ {0x02, 0xC2, 0xBB, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x02, 0xC3, 0x81, 0x00}, /* 0xB6 */ {0x02, 0xC3, 0x82, 0x00}, /* 0xB7 */ {0x02, 0xC3, 0x80, 0x00},
+    /* 0xB8 */ {0x02, 0xC2, 0xA9, 0x00}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x02, 0xC2, 0xA2, 0x00}, /* 0xBE */ {0x02, 0xC2, 0xA5, 0x00}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x02, 0xC3, 0xA3, 0x00}, /* 0xC7 */ {0x02, 0xC3, 0x83, 0x00},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x02, 0xC2, 0xA4, 0x00},
+    /* 0xD0 */ {0x02, 0xC3, 0xB0, 0x00}, /* 0xD1 */ {0x02, 0xC3, 0x90, 0x00}, /* 0xD2 */ {0x02, 0xC3, 0x8A, 0x00}, /* 0xD3 */ {0x02, 0xC3, 0x8B, 0x00}, /* 0xD4 */ {0x02, 0xC3, 0x88, 0x00}, /* 0xD5 */ {0x02, 0xC4, 0xB1, 0x00}, /* 0xD6 */ {0x02, 0xC3, 0x8D, 0x00}, /* 0xD7 */ {0x02, 0xC3, 0x8E, 0x00},
+    /* 0xD8 */ {0x02, 0xC3, 0x8F, 0x00}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x02, 0xC2, 0xA6, 0x00}, /* 0xDE */ {0x02, 0xC3, 0x8C, 0x00}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xC3, 0x93, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0x9F, 0x00}, /* 0xE2 */ {0x02, 0xC3, 0x94, 0x00}, /* 0xE3 */ {0x02, 0xC3, 0x92, 0x00}, /* 0xE4 */ {0x02, 0xC3, 0xB5, 0x00}, /* 0xE5 */ {0x02, 0xC3, 0x95, 0x00}, /* 0xE6 */ {0x02, 0xC2, 0xB5, 0x00}, /* 0xE7 */ {0x02, 0xC3, 0xBE, 0x00},
+    /* 0xE8 */ {0x02, 0xC3, 0x9E, 0x00}, /* 0xE9 */ {0x02, 0xC3, 0x9A, 0x00}, /* 0xEA */ {0x02, 0xC3, 0x9B, 0x00}, /* 0xEB */ {0x02, 0xC3, 0x99, 0x00}, /* 0xEC */ {0x02, 0xC3, 0xBD, 0x00}, /* 0xED */ {0x02, 0xC3, 0x9D, 0x00}, /* 0xEE */ {0x02, 0xC2, 0xAF, 0x00}, /* 0xEF */ {0x02, 0xC2, 0xB4, 0x00},
+    /* 0xF0 */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xF1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xF2 */ {0x03, 0xE2, 0x80, 0x97}, /* 0xF3 */ {0x02, 0xC2, 0xBE, 0x00}, /* 0xF4 */ {0x02, 0xC2, 0xB6, 0x00}, /* 0xF5 */ {0x02, 0xC2, 0xA7, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB7, 0x00}, /* 0xF7 */ {0x02, 0xC2, 0xB8, 0x00},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xFA */ {0x02, 0xC2, 0xB7, 0x00}, /* 0xFB */ {0x02, 0xC2, 0xB9, 0x00}, /* 0xFC */ {0x02, 0xC2, 0xB3, 0x00}, /* 0xFD */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
+};
+
+const CharConverter::Utf8Entry CharConverter::cp437_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xC3, 0x87, 0x00}, /* 0x81 */ {0x02, 0xC3, 0xBC, 0x00}, /* 0x82 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0x83 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0x84 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0x85 */ {0x02, 0xC3, 0xA0, 0x00}, /* 0x86 */ {0x02, 0xC3, 0xA5, 0x00}, /* 0x87 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0x88 */ {0x02, 0xC3, 0xAA, 0x00}, /* 0x89 */ {0x02, 0xC3, 0xAB, 0x00}, /* 0x8A */ {0x02, 0xC3, 0xA8, 0x00}, /* 0x8B */ {0x02, 0xC3, 0xAF, 0x00}, /* 0x8C */ {0x02, 0xC3, 0xAE, 0x00}, /* 0x8D */ {0x02, 0xC3, 0xAC, 0x00}, /* 0x8E */ {0x02, 0xC3, 0x84, 0x00}, /* 0x8F */ {0x02, 0xC3, 0x85, 0x00},
+    /* 0x90 */ {0x02, 0xC3, 0x89, 0x00}, /* 0x91 */ {0x02, 0xC3, 0xA6, 0x00}, /* 0x92 */ {0x02, 0xC3, 0x86, 0x00}, /* 0x93 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0x94 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0x95 */ {0x02, 0xC3, 0xB2, 0x00}, /* 0x96 */ {0x02, 0xC3, 0xBB, 0x00}, /* 0x97 */ {0x02, 0xC3, 0xB9, 0x00},
+    /* 0x98 */ {0x02, 0xC3, 0xBF, 0x00}, /* 0x99 */ {0x02, 0xC3, 0x96, 0x00}, /* 0x9A */ {0x02, 0xC3, 0x9C, 0x00}, /* 0x9B */ {0x02, 0xC2, 0xA2, 0x00}, /* 0x9C */ {0x02, 0xC2, 0xA3, 0x00}, /* 0x9D */ {0x02, 0xC2, 0xA5, 0x00}, /* 0x9E */ {0x03, 0xE2, 0x82, 0xA7}, /* 0x9F */ {0x02, 0xC6, 0x92, 0x00},
+    /* 0xA0 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xA1 */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xA2 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xA3 */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xA4 */ {0x02, 0xC3, 0xB1, 0x00}, /* 0xA5 */ {0x02, 0xC3, 0x91, 0x00}, /* 0xA6 */ {0x02, 0xC2, 0xAA, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xBA, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xBF, 0x00}, /* 0xA9 */ {0x03, 0xE2, 0x8C, 0x90}, /* 0xAA */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAB */ {0x02, 0xC2, 0xBD, 0x00}, /* 0xAC */ {0x02, 0xC2, 0xBC, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xA1, 0x00}, /* 0xAE */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAF */ {0x02, 0xC2, 0xBB, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x03, 0xE2, 0x95, 0xA1}, /* 0xB6 */ {0x03, 0xE2, 0x95, 0xA2}, /* 0xB7 */ {0x03, 0xE2, 0x95, 0x96},
+    /* 0xB8 */ {0x03, 0xE2, 0x95, 0x95}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x03, 0xE2, 0x95, 0x9C}, /* 0xBE */ {0x03, 0xE2, 0x95, 0x9B}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x03, 0xE2, 0x95, 0x9E}, /* 0xC7 */ {0x03, 0xE2, 0x95, 0x9F},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x03, 0xE2, 0x95, 0xA7},
+    /* 0xD0 */ {0x03, 0xE2, 0x95, 0xA8}, /* 0xD1 */ {0x03, 0xE2, 0x95, 0xA4}, /* 0xD2 */ {0x03, 0xE2, 0x95, 0xA5}, /* 0xD3 */ {0x03, 0xE2, 0x95, 0x99}, /* 0xD4 */ {0x03, 0xE2, 0x95, 0x98}, /* 0xD5 */ {0x03, 0xE2, 0x95, 0x92}, /* 0xD6 */ {0x03, 0xE2, 0x95, 0x93}, /* 0xD7 */ {0x03, 0xE2, 0x95, 0xAB},
+    /* 0xD8 */ {0x03, 0xE2, 0x95, 0xAA}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x03, 0xE2, 0x96, 0x8C}, /* 0xDE */ {0x03, 0xE2, 0x96, 0x90}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xCE, 0xB1, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0x9F, 0x00}, /* 0xE2 */ {0x02, 0xCE, 0x93, 0x00}, /* 0xE3 */ {0x02, 0xCF, 0x80, 0x00}, /* 0xE4 */ {0x02, 0xCE, 0xA3, 0x00}, /* 0xE5 */ {0x02, 0xCF, 0x83, 0x00}, /* 0xE6 */ {0x02, 0xC2, 0xB5, 0x00}, /* 0xE7 */ {0x02, 0xCF, 0x84, 0x00},
+    /* 0xE8 */ {0x02, 0xCE, 0xA6, 0x00}, /* 0xE9 */ {0x02, 0xCE, 0x98, 0x00}, /* 0xEA */ {0x02, 0xCE, 0xA9, 0x00}, /* 0xEB */ {0x02, 0xCE, 0xB4, 0x00}, /* 0xEC */ {0x03, 0xE2, 0x88, 0x9E}, /* 0xED */ {0x02, 0xCF, 0x86, 0x00}, /* 0xEE */ {0x02, 0xCE, 0xB5, 0x00}, /* 0xEF */ {0x03, 0xE2, 0x88, 0xA9},
+    /* 0xF0 */ {0x03, 0xE2, 0x89, 0xA1}, /* 0xF1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xF2 */ {0x03, 0xE2, 0x89, 0xA5}, /* 0xF3 */ {0x03, 0xE2, 0x89, 0xA4}, /* 0xF4 */ {0x03, 0xE2, 0x8C, 0xA0}, /* 0xF5 */ {0x03, 0xE2, 0x8C, 0xA1}, /* 0xF6 */ {0x02, 0xC3, 0xB7, 0x00}, /* 0xF7 */ {0x03, 0xE2, 0x89, 0x88},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x03, 0xE2, 0x88, 0x99}, /* 0xFA */ {0x02, 0xC2, 0xB7, 0x00}, /* 0xFB */ {0x03, 0xE2, 0x88, 0x9A}, /* 0xFC */ {0x03, 0xE2, 0x81, 0xBF}, /* 0xFD */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
+};
+
+const CharConverter::Utf8Entry CharConverter::cp852_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xC3, 0x87, 0x00}, /* 0x81 */ {0x02, 0xC3, 0xBC, 0x00}, /* 0x82 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0x83 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0x84 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0x85 */ {0x02, 0xC5, 0xAF, 0x00}, /* 0x86 */ {0x02, 0xC4, 0x87, 0x00}, /* 0x87 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0x88 */ {0x02, 0xC5, 0x82, 0x00}, /* 0x89 */ {0x02, 0xC3, 0xAB, 0x00}, /* 0x8A */ {0x02, 0xC5, 0x90, 0x00}, /* 0x8B */ {0x02, 0xC5, 0x91, 0x00}, /* 0x8C */ {0x02, 0xC3, 0xAE, 0x00}, /* 0x8D */ {0x02, 0xC5, 0xB9, 0x00}, /* 0x8E */ {0x02, 0xC3, 0x84, 0x00}, /* 0x8F */ {0x02, 0xC4, 0x86, 0x00},
+    /* 0x90 */ {0x02, 0xC3, 0x89, 0x00}, /* 0x91 */ {0x02, 0xC4, 0xB9, 0x00}, /* 0x92 */ {0x02, 0xC4, 0xBA, 0x00}, /* 0x93 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0x94 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0x95 */ {0x02, 0xC4, 0xBD, 0x00}, /* 0x96 */ {0x02, 0xC4, 0xBE, 0x00}, /* 0x97 */ {0x02, 0xC5, 0x9A, 0x00},
+    /* 0x98 */ {0x02, 0xC5, 0x9B, 0x00}, /* 0x99 */ {0x02, 0xC3, 0x96, 0x00}, /* 0x9A */ {0x02, 0xC3, 0x9C, 0x00}, /* 0x9B */ {0x02, 0xC5, 0xA4, 0x00}, /* 0x9C */ {0x02, 0xC5, 0xA5, 0x00}, /* 0x9D */ {0x02, 0xC5, 0x81, 0x00}, /* 0x9E */ {0x02, 0xC3, 0x97, 0x00}, /* 0x9F */ {0x02, 0xC4, 0x8D, 0x00},
+    /* 0xA0 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xA1 */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xA2 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xA3 */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xA4 */ {0x02, 0xC4, 0x84, 0x00}, /* 0xA5 */ {0x02, 0xC4, 0x85, 0x00}, /* 0xA6 */ {0x02, 0xC5, 0xBD, 0x00}, /* 0xA7 */ {0x02, 0xC5, 0xBE, 0x00},
+    /* 0xA8 */ {0x02, 0xC4, 0x98, 0x00}, /* 0xA9 */ {0x02, 0xC4, 0x99, 0x00}, /* 0xAA */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAB */ {0x02, 0xC5, 0xBA, 0x00}, /* 0xAC */ {0x02, 0xC4, 0x8C, 0x00}, /* 0xAD */ {0x02, 0xC5, 0x9F, 0x00}, /* 0xAE */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAF */ {0x02, 0xC2, 0xBB, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x02, 0xC3, 0x81, 0x00}, /* 0xB6 */ {0x02, 0xC3, 0x82, 0x00}, /* 0xB7 */ {0x02, 0xC4, 0x9A, 0x00},
+    /* 0xB8 */ {0x02, 0xC5, 0x9E, 0x00}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x02, 0xC5, 0xBB, 0x00}, /* 0xBE */ {0x02, 0xC5, 0xBC, 0x00}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x02, 0xC4, 0x82, 0x00}, /* 0xC7 */ {0x02, 0xC4, 0x83, 0x00},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x02, 0xC2, 0xA4, 0x00},
+    /* 0xD0 */ {0x02, 0xC4, 0x91, 0x00}, /* 0xD1 */ {0x02, 0xC4, 0x90, 0x00}, /* 0xD2 */ {0x02, 0xC4, 0x8E, 0x00}, /* 0xD3 */ {0x02, 0xC3, 0x8B, 0x00}, /* 0xD4 */ {0x02, 0xC4, 0x8F, 0x00}, /* 0xD5 */ {0x02, 0xC5, 0x87, 0x00}, /* 0xD6 */ {0x02, 0xC3, 0x8D, 0x00}, /* 0xD7 */ {0x02, 0xC3, 0x8E, 0x00},
+    /* 0xD8 */ {0x02, 0xC4, 0x9B, 0x00}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x02, 0xC5, 0xA2, 0x00}, /* 0xDE */ {0x02, 0xC5, 0xAE, 0x00}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xC3, 0x93, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0x9F, 0x00}, /* 0xE2 */ {0x02, 0xC3, 0x94, 0x00}, /* 0xE3 */ {0x02, 0xC5, 0x83, 0x00}, /* 0xE4 */ {0x02, 0xC5, 0x84, 0x00}, /* 0xE5 */ {0x02, 0xC5, 0x88, 0x00}, /* 0xE6 */ {0x02, 0xC5, 0xA0, 0x00}, /* 0xE7 */ {0x02, 0xC5, 0xA1, 0x00},
+    /* 0xE8 */ {0x02, 0xC5, 0x94, 0x00}, /* 0xE9 */ {0x02, 0xC3, 0x9A, 0x00}, /* 0xEA */ {0x02, 0xC5, 0x95, 0x00}, /* 0xEB */ {0x02, 0xC5, 0xB0, 0x00}, /* 0xEC */ {0x02, 0xC3, 0xBD, 0x00}, /* 0xED */ {0x02, 0xC3, 0x9D, 0x00}, /* 0xEE */ {0x02, 0xC5, 0xA3, 0x00}, /* 0xEF */ {0x02, 0xC2, 0xB4, 0x00},
+    /* 0xF0 */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xF1 */ {0x02, 0xCB, 0x9D, 0x00}, /* 0xF2 */ {0x02, 0xCB, 0x9B, 0x00}, /* 0xF3 */ {0x02, 0xCB, 0x87, 0x00}, /* 0xF4 */ {0x02, 0xCB, 0x98, 0x00}, /* 0xF5 */ {0x02, 0xC2, 0xA7, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB7, 0x00}, /* 0xF7 */ {0x02, 0xC2, 0xB8, 0x00},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xFA */ {0x02, 0xCB, 0x99, 0x00}, /* 0xFB */ {0x02, 0xC5, 0xB1, 0x00}, /* 0xFC */ {0x02, 0xC5, 0x98, 0x00}, /* 0xFD */ {0x02, 0xC5, 0x99, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
+};
+
+const CharConverter::Utf8Entry CharConverter::cp866_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xD0, 0x90, 0x00}, /* 0x81 */ {0x02, 0xD0, 0x91, 0x00}, /* 0x82 */ {0x02, 0xD0, 0x92, 0x00}, /* 0x83 */ {0x02, 0xD0, 0x93, 0x00}, /* 0x84 */ {0x02, 0xD0, 0x94, 0x00}, /* 0x85 */ {0x02, 0xD0, 0x95, 0x00}, /* 0x86 */ {0x02, 0xD0, 0x96, 0x00}, /* 0x87 */ {0x02, 0xD0, 0x97, 0x00},
+    /* 0x88 */ {0x02, 0xD0, 0x98, 0x00}, /* 0x89 */ {0x02, 0xD0, 0x99, 0x00}, /* 0x8A */ {0x02, 0xD0, 0x9A, 0x00}, /* 0x8B */ {0x02, 0xD0, 0x9B, 0x00}, /* 0x8C */ {0x02, 0xD0, 0x9C, 0x00}, /* 0x8D */ {0x02, 0xD0, 0x9D, 0x00}, /* 0x8E */ {0x02, 0xD0, 0x9E, 0x00}, /* 0x8F */ {0x02, 0xD0, 0x9F, 0x00},
+    /* 0x90 */ {0x02, 0xD0, 0xA0, 0x00}, /* 0x91 */ {0x02, 0xD0, 0xA1, 0x00}, /* 0x92 */ {0x02, 0xD0, 0xA2, 0x00}, /* 0x93 */ {0x02, 0xD0, 0xA3, 0x00}, /* 0x94 */ {0x02, 0xD0, 0xA4, 0x00}, /* 0x95 */ {0x02, 0xD0, 0xA5, 0x00}, /* 0x96 */ {0x02, 0xD0, 0xA6, 0x00}, /* 0x97 */ {0x02, 0xD0, 0xA7, 0x00},
+    /* 0x98 */ {0x02, 0xD0, 0xA8, 0x00}, /* 0x99 */ {0x02, 0xD0, 0xA9, 0x00}, /* 0x9A */ {0x02, 0xD0, 0xAA, 0x00}, /* 0x9B */ {0x02, 0xD0, 0xAB, 0x00}, /* 0x9C */ {0x02, 0xD0, 0xAC, 0x00}, /* 0x9D */ {0x02, 0xD0, 0xAD, 0x00}, /* 0x9E */ {0x02, 0xD0, 0xAE, 0x00}, /* 0x9F */ {0x02, 0xD0, 0xAF, 0x00},
+    /* 0xA0 */ {0x02, 0xD0, 0xB0, 0x00}, /* 0xA1 */ {0x02, 0xD0, 0xB1, 0x00}, /* 0xA2 */ {0x02, 0xD0, 0xB2, 0x00}, /* 0xA3 */ {0x02, 0xD0, 0xB3, 0x00}, /* 0xA4 */ {0x02, 0xD0, 0xB4, 0x00}, /* 0xA5 */ {0x02, 0xD0, 0xB5, 0x00}, /* 0xA6 */ {0x02, 0xD0, 0xB6, 0x00}, /* 0xA7 */ {0x02, 0xD0, 0xB7, 0x00},
+    /* 0xA8 */ {0x02, 0xD0, 0xB8, 0x00}, /* 0xA9 */ {0x02, 0xD0, 0xB9, 0x00}, /* 0xAA */ {0x02, 0xD0, 0xBA, 0x00}, /* 0xAB */ {0x02, 0xD0, 0xBB, 0x00}, /* 0xAC */ {0x02, 0xD0, 0xBC, 0x00}, /* 0xAD */ {0x02, 0xD0, 0xBD, 0x00}, /* 0xAE */ {0x02, 0xD0, 0xBE, 0x00}, /* 0xAF */ {0x02, 0xD0, 0xBF, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x03, 0xE2, 0x95, 0xA1}, /* 0xB6 */ {0x03, 0xE2, 0x95, 0xA2}, /* 0xB7 */ {0x03, 0xE2, 0x95, 0x96},
+    /* 0xB8 */ {0x03, 0xE2, 0x95, 0x95}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x03, 0xE2, 0x95, 0x9C}, /* 0xBE */ {0x03, 0xE2, 0x95, 0x9B}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x03, 0xE2, 0x95, 0x9E}, /* 0xC7 */ {0x03, 0xE2, 0x95, 0x9F},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x03, 0xE2, 0x95, 0xA7},
+    /* 0xD0 */ {0x03, 0xE2, 0x95, 0xA8}, /* 0xD1 */ {0x03, 0xE2, 0x95, 0xA4}, /* 0xD2 */ {0x03, 0xE2, 0x95, 0xA5}, /* 0xD3 */ {0x03, 0xE2, 0x95, 0x99}, /* 0xD4 */ {0x03, 0xE2, 0x95, 0x98}, /* 0xD5 */ {0x03, 0xE2, 0x95, 0x92}, /* 0xD6 */ {0x03, 0xE2, 0x95, 0x93}, /* 0xD7 */ {0x03, 0xE2, 0x95, 0xAB},
+    /* 0xD8 */ {0x03, 0xE2, 0x95, 0xAA}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x03, 0xE2, 0x96, 0x8C}, /* 0xDE */ {0x03, 0xE2, 0x96, 0x90}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xD1, 0x80, 0x00}, /* 0xE1 */ {0x02, 0xD1, 0x81, 0x00}, /* 0xE2 */ {0x02, 0xD1, 0x82, 0x00}, /* 0xE3 */ {0x02, 0xD1, 0x83, 0x00}, /* 0xE4 */ {0x02, 0xD1, 0x84, 0x00}, /* 0xE5 */ {0x02, 0xD1, 0x85, 0x00}, /* 0xE6 */ {0x02, 0xD1, 0x86, 0x00}, /* 0xE7 */ {0x02, 0xD1, 0x87, 0x00},
+    /* 0xE8 */ {0x02, 0xD1, 0x88, 0x00}, /* 0xE9 */ {0x02, 0xD1, 0x89, 0x00}, /* 0xEA */ {0x02, 0xD1, 0x8A, 0x00}, /* 0xEB */ {0x02, 0xD1, 0x8B, 0x00}, /* 0xEC */ {0x02, 0xD1, 0x8C, 0x00}, /* 0xED */ {0x02, 0xD1, 0x8D, 0x00}, /* 0xEE */ {0x02, 0xD1, 0x8E, 0x00}, /* 0xEF */ {0x02, 0xD1, 0x8F, 0x00},
+    /* 0xF0 */ {0x02, 0xD0, 0x81, 0x00}, /* 0xF1 */ {0x02, 0xD1, 0x91, 0x00}, /* 0xF2 */ {0x02, 0xD0, 0x84, 0x00}, /* 0xF3 */ {0x02, 0xD1, 0x94, 0x00}, /* 0xF4 */ {0x02, 0xD0, 0x87, 0x00}, /* 0xF5 */ {0x02, 0xD1, 0x97, 0x00}, /* 0xF6 */ {0x02, 0xD0, 0x8E, 0x00}, /* 0xF7 */ {0x02, 0xD1, 0x9E, 0x00},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x03, 0xE2, 0x88, 0x99}, /* 0xFA */ {0x02, 0xC2, 0xB7, 0x00}, /* 0xFB */ {0x03, 0xE2, 0x88, 0x9A}, /* 0xFC */ {0x03, 0xE2, 0x84, 0x96}, /* 0xFD */ {0x02, 0xC2, 0xA4, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
 };
 
-const char* CharConverter::cp850_to_utf8[128] = {
-    /* 0x80 */ "\xC3\x87", /* 0x81 */ "\xC3\xBC", /* 0x82 */ "\xC3\xA9", /* 0x83 */ "\xC3\xA2", /* 0x84 */ "\xC3\xA4", /* 0x85 */ "\xC3\xA0", /* 0x86 */ "\xC3\xA5", /* 0x87 */ "\xC3\xA7", /* 0x88 */ "\xC3\xAA", /* 0x89 */ "\xC3\xAB",
-    /* 0x8A */ "\xC3\xA8", /* 0x8B */ "\xC3\xAF", /* 0x8C */ "\xC3\xAE", /* 0x8D */ "\xC3\xAC", /* 0x8E */ "\xC3\x84", /* 0x8F */ "\xC3\x85", /* 0x90 */ "\xC3\x89", /* 0x91 */ "\xC3\xA6", /* 0x92 */ "\xC3\x86", /* 0x93 */ "\xC3\xB4",
-    /* 0x94 */ "\xC3\xB6", /* 0x95 */ "\xC3\xB2", /* 0x96 */ "\xC3\xBB", /* 0x97 */ "\xC3\xB9", /* 0x98 */ "\xC3\xBF", /* 0x99 */ "\xC3\x96", /* 0x9A */ "\xC3\x9C", /* 0x9B */ "\xC3\xB8", /* 0x9C */ "\xC2\xA3", /* 0x9D */ "\xC3\x98",
-    /* 0x9E */ "\xC3\x97", /* 0x9F */ "\xC6\x92", /* 0xA0 */ "\xC3\xA1", /* 0xA1 */ "\xC3\xAD", /* 0xA2 */ "\xC3\xB3", /* 0xA3 */ "\xC3\xBA", /* 0xA4 */ "\xC3\xB1", /* 0xA5 */ "\xC3\x91", /* 0xA6 */ "\xC2\xAA", /* 0xA7 */ "\xC2\xBA",
-    /* 0xA8 */ "\xC2\xBF", /* 0xA9 */ "\xC2\xAE", /* 0xAA */ "\xC2\xAC", /* 0xAB */ "\xC2\xBD", /* 0xAC */ "\xC2\xBC", /* 0xAD */ "\xC2\xA1", /* 0xAE */ "\xC2\xAB", /* 0xAF */ "\xC2\xBB", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xC3\x81", /* 0xB6 */ "\xC3\x82", /* 0xB7 */ "\xC3\x80", /* 0xB8 */ "\xC2\xA9", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xC2\xA2", /* 0xBE */ "\xC2\xA5", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xC3\xA3", /* 0xC7 */ "\xC3\x83", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xC2\xA4", /* 0xD0 */ "\xC3\xB0", /* 0xD1 */ "\xC3\x90", /* 0xD2 */ "\xC3\x8A", /* 0xD3 */ "\xC3\x8B", /* 0xD4 */ "\xC3\x88", /* 0xD5 */ "\xC4\xB1", /* 0xD6 */ "\xC3\x8D",
-    /* 0xD7 */ "\xC3\x8E", /* 0xD8 */ "\xC3\x8F", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xC2\xA6", /* 0xDE */ "\xC3\x8C", /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xC3\x93",
-    /* 0xE1 */ "\xC3\x9F", /* 0xE2 */ "\xC3\x94", /* 0xE3 */ "\xC3\x92", /* 0xE4 */ "\xC3\xB5", /* 0xE5 */ "\xC3\x95", /* 0xE6 */ "\xC2\xB5", /* 0xE7 */ "\xC3\xBE", /* 0xE8 */ "\xC3\x9E", /* 0xE9 */ "\xC3\x9A", /* 0xEA */ "\xC3\x9B",
-    /* 0xEB */ "\xC3\x99", /* 0xEC */ "\xC3\xBD", /* 0xED */ "\xC3\x9D", /* 0xEE */ "\xC2\xAF", /* 0xEF */ "\xC2\xB4", /* 0xF0 */ "\xC2\xAD", /* 0xF1 */ "\xC2\xB1", /* 0xF2 */ "\xE2\x80\x97", /* 0xF3 */ "\xC2\xBE", /* 0xF4 */ "\xC2\xB6",
-    /* 0xF5 */ "\xC2\xA7", /* 0xF6 */ "\xC3\xB7", /* 0xF7 */ "\xC2\xB8", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xC2\xA8", /* 0xFA */ "\xC2\xB7", /* 0xFB */ "\xC2\xB9", /* 0xFC */ "\xC2\xB3", /* 0xFD */ "\xC2\xB2", /* 0xFE */ "\xE2\x96\xA0",
-    /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::cp737_to_utf8[128] = {
+    /* 0x80 */ {0x02, 0xCE, 0x91, 0x00}, /* 0x81 */ {0x02, 0xCE, 0x92, 0x00}, /* 0x82 */ {0x02, 0xCE, 0x93, 0x00}, /* 0x83 */ {0x02, 0xCE, 0x94, 0x00}, /* 0x84 */ {0x02, 0xCE, 0x95, 0x00}, /* 0x85 */ {0x02, 0xCE, 0x96, 0x00}, /* 0x86 */ {0x02, 0xCE, 0x97, 0x00}, /* 0x87 */ {0x02, 0xCE, 0x98, 0x00},
+    /* 0x88 */ {0x02, 0xCE, 0x99, 0x00}, /* 0x89 */ {0x02, 0xCE, 0x9A, 0x00}, /* 0x8A */ {0x02, 0xCE, 0x9B, 0x00}, /* 0x8B */ {0x02, 0xCE, 0x9C, 0x00}, /* 0x8C */ {0x02, 0xCE, 0x9D, 0x00}, /* 0x8D */ {0x02, 0xCE, 0x9E, 0x00}, /* 0x8E */ {0x02, 0xCE, 0x9F, 0x00}, /* 0x8F */ {0x02, 0xCE, 0xA0, 0x00},
+    /* 0x90 */ {0x02, 0xCE, 0xA1, 0x00}, /* 0x91 */ {0x02, 0xCE, 0xA3, 0x00}, /* 0x92 */ {0x02, 0xCE, 0xA4, 0x00}, /* 0x93 */ {0x02, 0xCE, 0xA5, 0x00}, /* 0x94 */ {0x02, 0xCE, 0xA6, 0x00}, /* 0x95 */ {0x02, 0xCE, 0xA7, 0x00}, /* 0x96 */ {0x02, 0xCE, 0xA8, 0x00}, /* 0x97 */ {0x02, 0xCE, 0xA9, 0x00},
+    /* 0x98 */ {0x02, 0xCE, 0xB1, 0x00}, /* 0x99 */ {0x02, 0xCE, 0xB2, 0x00}, /* 0x9A */ {0x02, 0xCE, 0xB3, 0x00}, /* 0x9B */ {0x02, 0xCE, 0xB4, 0x00}, /* 0x9C */ {0x02, 0xCE, 0xB5, 0x00}, /* 0x9D */ {0x02, 0xCE, 0xB6, 0x00}, /* 0x9E */ {0x02, 0xCE, 0xB7, 0x00}, /* 0x9F */ {0x02, 0xCE, 0xB8, 0x00},
+    /* 0xA0 */ {0x02, 0xCE, 0xB9, 0x00}, /* 0xA1 */ {0x02, 0xCE, 0xBA, 0x00}, /* 0xA2 */ {0x02, 0xCE, 0xBB, 0x00}, /* 0xA3 */ {0x02, 0xCE, 0xBC, 0x00}, /* 0xA4 */ {0x02, 0xCE, 0xBD, 0x00}, /* 0xA5 */ {0x02, 0xCE, 0xBE, 0x00}, /* 0xA6 */ {0x02, 0xCE, 0xBF, 0x00}, /* 0xA7 */ {0x02, 0xCF, 0x80, 0x00},
+    /* 0xA8 */ {0x02, 0xCF, 0x81, 0x00}, /* 0xA9 */ {0x02, 0xCF, 0x83, 0x00}, /* 0xAA */ {0x02, 0xCF, 0x82, 0x00}, /* 0xAB */ {0x02, 0xCF, 0x84, 0x00}, /* 0xAC */ {0x02, 0xCF, 0x85, 0x00}, /* 0xAD */ {0x02, 0xCF, 0x86, 0x00}, /* 0xAE */ {0x02, 0xCF, 0x87, 0x00}, /* 0xAF */ {0x02, 0xCF, 0x88, 0x00},
+    /* 0xB0 */ {0x03, 0xE2, 0x96, 0x91}, /* 0xB1 */ {0x03, 0xE2, 0x96, 0x92}, /* 0xB2 */ {0x03, 0xE2, 0x96, 0x93}, /* 0xB3 */ {0x03, 0xE2, 0x94, 0x82}, /* 0xB4 */ {0x03, 0xE2, 0x94, 0xA4}, /* 0xB5 */ {0x03, 0xE2, 0x95, 0xA1}, /* 0xB6 */ {0x03, 0xE2, 0x95, 0xA2}, /* 0xB7 */ {0x03, 0xE2, 0x95, 0x96},
+    /* 0xB8 */ {0x03, 0xE2, 0x95, 0x95}, /* 0xB9 */ {0x03, 0xE2, 0x95, 0xA3}, /* 0xBA */ {0x03, 0xE2, 0x95, 0x91}, /* 0xBB */ {0x03, 0xE2, 0x95, 0x97}, /* 0xBC */ {0x03, 0xE2, 0x95, 0x9D}, /* 0xBD */ {0x03, 0xE2, 0x95, 0x9C}, /* 0xBE */ {0x03, 0xE2, 0x95, 0x9B}, /* 0xBF */ {0x03, 0xE2, 0x94, 0x90},
+    /* 0xC0 */ {0x03, 0xE2, 0x94, 0x94}, /* 0xC1 */ {0x03, 0xE2, 0x94, 0xB4}, /* 0xC2 */ {0x03, 0xE2, 0x94, 0xAC}, /* 0xC3 */ {0x03, 0xE2, 0x94, 0x9C}, /* 0xC4 */ {0x03, 0xE2, 0x94, 0x80}, /* 0xC5 */ {0x03, 0xE2, 0x94, 0xBC}, /* 0xC6 */ {0x03, 0xE2, 0x95, 0x9E}, /* 0xC7 */ {0x03, 0xE2, 0x95, 0x9F},
+    /* 0xC8 */ {0x03, 0xE2, 0x95, 0x9A}, /* 0xC9 */ {0x03, 0xE2, 0x95, 0x94}, /* 0xCA */ {0x03, 0xE2, 0x95, 0xA9}, /* 0xCB */ {0x03, 0xE2, 0x95, 0xA6}, /* 0xCC */ {0x03, 0xE2, 0x95, 0xA0}, /* 0xCD */ {0x03, 0xE2, 0x95, 0x90}, /* 0xCE */ {0x03, 0xE2, 0x95, 0xAC}, /* 0xCF */ {0x03, 0xE2, 0x95, 0xA7},
+    /* 0xD0 */ {0x03, 0xE2, 0x95, 0xA8}, /* 0xD1 */ {0x03, 0xE2, 0x95, 0xA4}, /* 0xD2 */ {0x03, 0xE2, 0x95, 0xA5}, /* 0xD3 */ {0x03, 0xE2, 0x95, 0x99}, /* 0xD4 */ {0x03, 0xE2, 0x95, 0x98}, /* 0xD5 */ {0x03, 0xE2, 0x95, 0x92}, /* 0xD6 */ {0x03, 0xE2, 0x95, 0x93}, /* 0xD7 */ {0x03, 0xE2, 0x95, 0xAB},
+    /* 0xD8 */ {0x03, 0xE2, 0x95, 0xAA}, /* 0xD9 */ {0x03, 0xE2, 0x94, 0x98}, /* 0xDA */ {0x03, 0xE2, 0x94, 0x8C}, /* 0xDB */ {0x03, 0xE2, 0x96, 0x88}, /* 0xDC */ {0x03, 0xE2, 0x96, 0x84}, /* 0xDD */ {0x03, 0xE2, 0x96, 0x8C}, /* 0xDE */ {0x03, 0xE2, 0x96, 0x90}, /* 0xDF */ {0x03, 0xE2, 0x96, 0x80},
+    /* 0xE0 */ {0x02, 0xCF, 0x89, 0x00}, /* 0xE1 */ {0x02, 0xCE, 0xAC, 0x00}, /* 0xE2 */ {0x02, 0xCE, 0xAD, 0x00}, /* 0xE3 */ {0x02, 0xCE, 0xAE, 0x00}, /* 0xE4 */ {0x02, 0xCF, 0x8A, 0x00}, /* 0xE5 */ {0x02, 0xCE, 0xAF, 0x00}, /* 0xE6 */ {0x02, 0xCF, 0x8C, 0x00}, /* 0xE7 */ {0x02, 0xCF, 0x8D, 0x00},
+    /* 0xE8 */ {0x02, 0xCF, 0x8B, 0x00}, /* 0xE9 */ {0x02, 0xCF, 0x8E, 0x00}, /* 0xEA */ {0x02, 0xCE, 0x86, 0x00}, /* 0xEB */ {0x02, 0xCE, 0x88, 0x00}, /* 0xEC */ {0x02, 0xCE, 0x89, 0x00}, /* 0xED */ {0x02, 0xCE, 0x8A, 0x00}, /* 0xEE */ {0x02, 0xCE, 0x8C, 0x00}, /* 0xEF */ {0x02, 0xCE, 0x8E, 0x00},
+    /* 0xF0 */ {0x02, 0xCE, 0x8F, 0x00}, /* 0xF1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xF2 */ {0x03, 0xE2, 0x89, 0xA5}, /* 0xF3 */ {0x03, 0xE2, 0x89, 0xA4}, /* 0xF4 */ {0x02, 0xCE, 0xAA, 0x00}, /* 0xF5 */ {0x02, 0xCE, 0xAB, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB7, 0x00}, /* 0xF7 */ {0x03, 0xE2, 0x89, 0x88},
+    /* 0xF8 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xF9 */ {0x03, 0xE2, 0x88, 0x99}, /* 0xFA */ {0x02, 0xC2, 0xB7, 0x00}, /* 0xFB */ {0x03, 0xE2, 0x88, 0x9A}, /* 0xFC */ {0x03, 0xE2, 0x81, 0xBF}, /* 0xFD */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xFE */ {0x03, 0xE2, 0x96, 0xA0}, /* 0xFF */ {0x02, 0xC2, 0xA0, 0x00},
 };
 
-const char* CharConverter::cp437_to_utf8[128] = {
-    /* 0x80 */ "\xC3\x87", /* 0x81 */ "\xC3\xBC", /* 0x82 */ "\xC3\xA9", /* 0x83 */ "\xC3\xA2", /* 0x84 */ "\xC3\xA4", /* 0x85 */ "\xC3\xA0", /* 0x86 */ "\xC3\xA5", /* 0x87 */ "\xC3\xA7", /* 0x88 */ "\xC3\xAA", /* 0x89 */ "\xC3\xAB",
-    /* 0x8A */ "\xC3\xA8", /* 0x8B */ "\xC3\xAF", /* 0x8C */ "\xC3\xAE", /* 0x8D */ "\xC3\xAC", /* 0x8E */ "\xC3\x84", /* 0x8F */ "\xC3\x85", /* 0x90 */ "\xC3\x89", /* 0x91 */ "\xC3\xA6", /* 0x92 */ "\xC3\x86", /* 0x93 */ "\xC3\xB4",
-    /* 0x94 */ "\xC3\xB6", /* 0x95 */ "\xC3\xB2", /* 0x96 */ "\xC3\xBB", /* 0x97 */ "\xC3\xB9", /* 0x98 */ "\xC3\xBF", /* 0x99 */ "\xC3\x96", /* 0x9A */ "\xC3\x9C", /* 0x9B */ "\xC2\xA2", /* 0x9C */ "\xC2\xA3", /* 0x9D */ "\xC2\xA5",
-    /* 0x9E */ "\xE2\x82\xA7", /* 0x9F */ "\xC6\x92", /* 0xA0 */ "\xC3\xA1", /* 0xA1 */ "\xC3\xAD", /* 0xA2 */ "\xC3\xB3", /* 0xA3 */ "\xC3\xBA", /* 0xA4 */ "\xC3\xB1", /* 0xA5 */ "\xC3\x91", /* 0xA6 */ "\xC2\xAA", /* 0xA7 */ "\xC2\xBA",
-    /* 0xA8 */ "\xC2\xBF", /* 0xA9 */ "\xE2\x8C\x90", /* 0xAA */ "\xC2\xAC", /* 0xAB */ "\xC2\xBD", /* 0xAC */ "\xC2\xBC", /* 0xAD */ "\xC2\xA1", /* 0xAE */ "\xC2\xAB", /* 0xAF */ "\xC2\xBB", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xE2\x95\xA1", /* 0xB6 */ "\xE2\x95\xA2", /* 0xB7 */ "\xE2\x95\x96", /* 0xB8 */ "\xE2\x95\x95", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xE2\x95\x9C", /* 0xBE */ "\xE2\x95\x9B", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xE2\x95\x9E", /* 0xC7 */ "\xE2\x95\x9F", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xE2\x95\xA7", /* 0xD0 */ "\xE2\x95\xA8", /* 0xD1 */ "\xE2\x95\xA4", /* 0xD2 */ "\xE2\x95\xA5", /* 0xD3 */ "\xE2\x95\x99", /* 0xD4 */ "\xE2\x95\x98", /* 0xD5 */ "\xE2\x95\x92",
-    /* 0xD6 */ "\xE2\x95\x93", /* 0xD7 */ "\xE2\x95\xAB", /* 0xD8 */ "\xE2\x95\xAA", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xE2\x96\x8C", /* 0xDE */ "\xE2\x96\x90",
-    /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xCE\xB1", /* 0xE1 */ "\xC3\x9F", /* 0xE2 */ "\xCE\x93", /* 0xE3 */ "\xCF\x80", /* 0xE4 */ "\xCE\xA3", /* 0xE5 */ "\xCF\x83", /* 0xE6 */ "\xC2\xB5", /* 0xE7 */ "\xCF\x84", /* 0xE8 */ "\xCE\xA6",
-    /* 0xE9 */ "\xCE\x98", /* 0xEA */ "\xCE\xA9", /* 0xEB */ "\xCE\xB4", /* 0xEC */ "\xE2\x88\x9E", /* 0xED */ "\xCF\x86", /* 0xEE */ "\xCE\xB5", /* 0xEF */ "\xE2\x88\xA9", /* 0xF0 */ "\xE2\x89\xA1", /* 0xF1 */ "\xC2\xB1", /* 0xF2 */ "\xE2\x89\xA5",
-    /* 0xF3 */ "\xE2\x89\xA4", /* 0xF4 */ "\xE2\x8C\xA0", /* 0xF5 */ "\xE2\x8C\xA1", /* 0xF6 */ "\xC3\xB7", /* 0xF7 */ "\xE2\x89\x88", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xE2\x88\x99", /* 0xFA */ "\xC2\xB7", /* 0xFB */ "\xE2\x88\x9A",
-    /* 0xFC */ "\xE2\x81\xBF", /* 0xFD */ "\xC2\xB2", /* 0xFE */ "\xE2\x96\xA0", /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::iso8859_1_to_utf8[128] = {
+    /* 0x80 */ {0x00, 0x00, 0x00, 0x00}, /* 0x81 */ {0x00, 0x00, 0x00, 0x00}, /* 0x82 */ {0x00, 0x00, 0x00, 0x00}, /* 0x83 */ {0x00, 0x00, 0x00, 0x00}, /* 0x84 */ {0x00, 0x00, 0x00, 0x00}, /* 0x85 */ {0x00, 0x00, 0x00, 0x00}, /* 0x86 */ {0x00, 0x00, 0x00, 0x00}, /* 0x87 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x88 */ {0x00, 0x00, 0x00, 0x00}, /* 0x89 */ {0x00, 0x00, 0x00, 0x00}, /* 0x8A */ {0x00, 0x00, 0x00, 0x00}, /* 0x8B */ {0x00, 0x00, 0x00, 0x00}, /* 0x8C */ {0x00, 0x00, 0x00, 0x00}, /* 0x8D */ {0x00, 0x00, 0x00, 0x00}, /* 0x8E */ {0x00, 0x00, 0x00, 0x00}, /* 0x8F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x90 */ {0x00, 0x00, 0x00, 0x00}, /* 0x91 */ {0x00, 0x00, 0x00, 0x00}, /* 0x92 */ {0x00, 0x00, 0x00, 0x00}, /* 0x93 */ {0x00, 0x00, 0x00, 0x00}, /* 0x94 */ {0x00, 0x00, 0x00, 0x00}, /* 0x95 */ {0x00, 0x00, 0x00, 0x00}, /* 0x96 */ {0x00, 0x00, 0x00, 0x00}, /* 0x97 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x98 */ {0x00, 0x00, 0x00, 0x00}, /* 0x99 */ {0x00, 0x00, 0x00, 0x00}, /* 0x9A */ {0x00, 0x00, 0x00, 0x00}, /* 0x9B */ {0x00, 0x00, 0x00, 0x00}, /* 0x9C */ {0x00, 0x00, 0x00, 0x00}, /* 0x9D */ {0x00, 0x00, 0x00, 0x00}, /* 0x9E */ {0x00, 0x00, 0x00, 0x00}, /* 0x9F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0xA0 */ {0x02, 0xC2, 0xA0, 0x00}, /* 0xA1 */ {0x02, 0xC2, 0xA1, 0x00}, /* 0xA2 */ {0x02, 0xC2, 0xA2, 0x00}, /* 0xA3 */ {0x02, 0xC2, 0xA3, 0x00}, /* 0xA4 */ {0x02, 0xC2, 0xA4, 0x00}, /* 0xA5 */ {0x02, 0xC2, 0xA5, 0x00}, /* 0xA6 */ {0x02, 0xC2, 0xA6, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xA7, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xA9 */ {0x02, 0xC2, 0xA9, 0x00}, /* 0xAA */ {0x02, 0xC2, 0xAA, 0x00}, /* 0xAB */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAC */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xAE */ {0x02, 0xC2, 0xAE, 0x00}, /* 0xAF */ {0x02, 0xC2, 0xAF, 0x00},
+    /* 0xB0 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xB1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xB2 */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xB3 */ {0x02, 0xC2, 0xB3, 0x00}, /* 0xB4 */ {0x02, 0xC2, 0xB4, 0x00}, /* 0xB5 */ {0x02, 0xC2, 0xB5, 0x00}, /* 0xB6 */ {0x02, 0xC2, 0xB6, 0x00}, /* 0xB7 */ {0x02, 0xC2, 0xB7, 0x00},
+    /* 0xB8 */ {0x02, 0xC2, 0xB8, 0x00}, /* 0xB9 */ {0x02, 0xC2, 0xB9, 0x00}, /* 0xBA */ {0x02, 0xC2, 0xBA, 0x00}, /* 0xBB */ {0x02, 0xC2, 0xBB, 0x00}, /* 0xBC */ {0x02, 0xC2, 0xBC, 0x00}, /* 0xBD */ {0x02, 0xC2, 0xBD, 0x00}, /* 0xBE */ {0x02, 0xC2, 0xBE, 0x00}, /* 0xBF */ {0x02, 0xC2, 0xBF, 0x00},
+    /* 0xC0 */ {0x02, 0xC3, 0x80, 0x00}, /* 0xC1 */ {0x02, 0xC3, 0x81, 0x00}, /* 0xC2 */ {0x02, 0xC3, 0x82, 0x00}, /* 0xC3 */ {0x02, 0xC3, 0x83, 0x00}, /* 0xC4 */ {0x02, 0xC3, 0x84, 0x00}, /* 0xC5 */ {0x02, 0xC3, 0x85, 0x00}, /* 0xC6 */ {0x02, 0xC3, 0x86, 0x00}, /* 0xC7 */ {0x02, 0xC3, 0x87, 0x00},
+    /* 0xC8 */ {0x02, 0xC3, 0x88, 0x00}, /* 0xC9 */ {0x02, 0xC3, 0x89, 0x00}, /* 0xCA */ {0x02, 0xC3, 0x8A, 0x00}, /* 0xCB */ {0x02, 0xC3, 0x8B, 0x00}, /* 0xCC */ {0x02, 0xC3, 0x8C, 0x00}, /* 0xCD */ {0x02, 0xC3, 0x8D, 0x00}, /* 0xCE */ {0x02, 0xC3, 0x8E, 0x00}, /* 0xCF */ {0x02, 0xC3, 0x8F, 0x00},
+    /* 0xD0 */ {0x02, 0xC3, 0x90, 0x00}, /* 0xD1 */ {0x02, 0xC3, 0x91, 0x00}, /* 0xD2 */ {0x02, 0xC3, 0x92, 0x00}, /* 0xD3 */ {0x02, 0xC3, 0x93, 0x00}, /* 0xD4 */ {0x02, 0xC3, 0x94, 0x00}, /* 0xD5 */ {0x02, 0xC3, 0x95, 0x00}, /* 0xD6 */ {0x02, 0xC3, 0x96, 0x00}, /* 0xD7 */ {0x02, 0xC3, 0x97, 0x00},
+    /* 0xD8 */ {0x02, 0xC3, 0x98, 0x00}, /* 0xD9 */ {0x02, 0xC3, 0x99, 0x00}, /* 0xDA */ {0x02, 0xC3, 0x9A, 0x00}, /* 0xDB */ {0x02, 0xC3, 0x9B, 0x00}, /* 0xDC */ {0x02, 0xC3, 0x9C, 0x00}, /* 0xDD */ {0x02, 0xC3, 0x9D, 0x00}, /* 0xDE */ {0x02, 0xC3, 0x9E, 0x00}, /* 0xDF */ {0x02, 0xC3, 0x9F, 0x00},
+    /* 0xE0 */ {0x02, 0xC3, 0xA0, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xE2 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0xE3 */ {0x02, 0xC3, 0xA3, 0x00}, /* 0xE4 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0xE5 */ {0x02, 0xC3, 0xA5, 0x00}, /* 0xE6 */ {0x02, 0xC3, 0xA6, 0x00}, /* 0xE7 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0xE8 */ {0x02, 0xC3, 0xA8, 0x00}, /* 0xE9 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0xEA */ {0x02, 0xC3, 0xAA, 0x00}, /* 0xEB */ {0x02, 0xC3, 0xAB, 0x00}, /* 0xEC */ {0x02, 0xC3, 0xAC, 0x00}, /* 0xED */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xEE */ {0x02, 0xC3, 0xAE, 0x00}, /* 0xEF */ {0x02, 0xC3, 0xAF, 0x00},
+    /* 0xF0 */ {0x02, 0xC3, 0xB0, 0x00}, /* 0xF1 */ {0x02, 0xC3, 0xB1, 0x00}, /* 0xF2 */ {0x02, 0xC3, 0xB2, 0x00}, /* 0xF3 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xF4 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0xF5 */ {0x02, 0xC3, 0xB5, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0xF7 */ {0x02, 0xC3, 0xB7, 0x00},
+    /* 0xF8 */ {0x02, 0xC3, 0xB8, 0x00}, /* 0xF9 */ {0x02, 0xC3, 0xB9, 0x00}, /* 0xFA */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xFB */ {0x02, 0xC3, 0xBB, 0x00}, /* 0xFC */ {0x02, 0xC3, 0xBC, 0x00}, /* 0xFD */ {0x02, 0xC3, 0xBD, 0x00}, /* 0xFE */ {0x02, 0xC3, 0xBE, 0x00}, /* 0xFF */ {0x02, 0xC3, 0xBF, 0x00},
 };
 
-const char* CharConverter::cp852_to_utf8[128] = {
-    /* 0x80 */ "\xC3\x87", /* 0x81 */ "\xC3\xBC", /* 0x82 */ "\xC3\xA9", /* 0x83 */ "\xC3\xA2", /* 0x84 */ "\xC3\xA4", /* 0x85 */ "\xC5\xAF", /* 0x86 */ "\xC4\x87", /* 0x87 */ "\xC3\xA7", /* 0x88 */ "\xC5\x82", /* 0x89 */ "\xC3\xAB",
-    /* 0x8A */ "\xC5\x90", /* 0x8B */ "\xC5\x91", /* 0x8C */ "\xC3\xAE", /* 0x8D */ "\xC5\xB9", /* 0x8E */ "\xC3\x84", /* 0x8F */ "\xC4\x86", /* 0x90 */ "\xC3\x89", /* 0x91 */ "\xC4\xB9", /* 0x92 */ "\xC4\xBA", /* 0x93 */ "\xC3\xB4",
-    /* 0x94 */ "\xC3\xB6", /* 0x95 */ "\xC4\xBD", /* 0x96 */ "\xC4\xBE", /* 0x97 */ "\xC5\x9A", /* 0x98 */ "\xC5\x9B", /* 0x99 */ "\xC3\x96", /* 0x9A */ "\xC3\x9C", /* 0x9B */ "\xC5\xA4", /* 0x9C */ "\xC5\xA5", /* 0x9D */ "\xC5\x81",
-    /* 0x9E */ "\xC3\x97", /* 0x9F */ "\xC4\x8D", /* 0xA0 */ "\xC3\xA1", /* 0xA1 */ "\xC3\xAD", /* 0xA2 */ "\xC3\xB3", /* 0xA3 */ "\xC3\xBA", /* 0xA4 */ "\xC4\x84", /* 0xA5 */ "\xC4\x85", /* 0xA6 */ "\xC5\xBD", /* 0xA7 */ "\xC5\xBE",
-    /* 0xA8 */ "\xC4\x98", /* 0xA9 */ "\xC4\x99", /* 0xAA */ "\xC2\xAC", /* 0xAB */ "\xC5\xBA", /* 0xAC */ "\xC4\x8C", /* 0xAD */ "\xC5\x9F", /* 0xAE */ "\xC2\xAB", /* 0xAF */ "\xC2\xBB", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xC3\x81", /* 0xB6 */ "\xC3\x82", /* 0xB7 */ "\xC4\x9A", /* 0xB8 */ "\xC5\x9E", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xC5\xBB", /* 0xBE */ "\xC5\xBC", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xC4\x82", /* 0xC7 */ "\xC4\x83", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xC2\xA4", /* 0xD0 */ "\xC4\x91", /* 0xD1 */ "\xC4\x90", /* 0xD2 */ "\xC4\x8E", /* 0xD3 */ "\xC3\x8B", /* 0xD4 */ "\xC4\x8F", /* 0xD5 */ "\xC5\x87", /* 0xD6 */ "\xC3\x8D",
-    /* 0xD7 */ "\xC3\x8E", /* 0xD8 */ "\xC4\x9B", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xC5\xA2", /* 0xDE */ "\xC5\xAE", /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xC3\x93",
-    /* 0xE1 */ "\xC3\x9F", /* 0xE2 */ "\xC3\x94", /* 0xE3 */ "\xC5\x83", /* 0xE4 */ "\xC5\x84", /* 0xE5 */ "\xC5\x88", /* 0xE6 */ "\xC5\xA0", /* 0xE7 */ "\xC5\xA1", /* 0xE8 */ "\xC5\x94", /* 0xE9 */ "\xC3\x9A", /* 0xEA */ "\xC5\x95",
-    /* 0xEB */ "\xC5\xB0", /* 0xEC */ "\xC3\xBD", /* 0xED */ "\xC3\x9D", /* 0xEE */ "\xC5\xA3", /* 0xEF */ "\xC2\xB4", /* 0xF0 */ "\xC2\xAD", /* 0xF1 */ "\xCB\x9D", /* 0xF2 */ "\xCB\x9B", /* 0xF3 */ "\xCB\x87", /* 0xF4 */ "\xCB\x98",
-    /* 0xF5 */ "\xC2\xA7", /* 0xF6 */ "\xC3\xB7", /* 0xF7 */ "\xC2\xB8", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xC2\xA8", /* 0xFA */ "\xCB\x99", /* 0xFB */ "\xC5\xB1", /* 0xFC */ "\xC5\x98", /* 0xFD */ "\xC5\x99", /* 0xFE */ "\xE2\x96\xA0",
-    /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::iso8859_2_to_utf8[128] = {
+    /* 0x80 */ {0x00, 0x00, 0x00, 0x00}, /* 0x81 */ {0x00, 0x00, 0x00, 0x00}, /* 0x82 */ {0x00, 0x00, 0x00, 0x00}, /* 0x83 */ {0x00, 0x00, 0x00, 0x00}, /* 0x84 */ {0x00, 0x00, 0x00, 0x00}, /* 0x85 */ {0x00, 0x00, 0x00, 0x00}, /* 0x86 */ {0x00, 0x00, 0x00, 0x00}, /* 0x87 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x88 */ {0x00, 0x00, 0x00, 0x00}, /* 0x89 */ {0x00, 0x00, 0x00, 0x00}, /* 0x8A */ {0x00, 0x00, 0x00, 0x00}, /* 0x8B */ {0x00, 0x00, 0x00, 0x00}, /* 0x8C */ {0x00, 0x00, 0x00, 0x00}, /* 0x8D */ {0x00, 0x00, 0x00, 0x00}, /* 0x8E */ {0x00, 0x00, 0x00, 0x00}, /* 0x8F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x90 */ {0x00, 0x00, 0x00, 0x00}, /* 0x91 */ {0x00, 0x00, 0x00, 0x00}, /* 0x92 */ {0x00, 0x00, 0x00, 0x00}, /* 0x93 */ {0x00, 0x00, 0x00, 0x00}, /* 0x94 */ {0x00, 0x00, 0x00, 0x00}, /* 0x95 */ {0x00, 0x00, 0x00, 0x00}, /* 0x96 */ {0x00, 0x00, 0x00, 0x00}, /* 0x97 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x98 */ {0x00, 0x00, 0x00, 0x00}, /* 0x99 */ {0x00, 0x00, 0x00, 0x00}, /* 0x9A */ {0x00, 0x00, 0x00, 0x00}, /* 0x9B */ {0x00, 0x00, 0x00, 0x00}, /* 0x9C */ {0x00, 0x00, 0x00, 0x00}, /* 0x9D */ {0x00, 0x00, 0x00, 0x00}, /* 0x9E */ {0x00, 0x00, 0x00, 0x00}, /* 0x9F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0xA0 */ {0x02, 0xC2, 0xA0, 0x00}, /* 0xA1 */ {0x02, 0xC4, 0x84, 0x00}, /* 0xA2 */ {0x02, 0xCB, 0x98, 0x00}, /* 0xA3 */ {0x02, 0xC5, 0x81, 0x00}, /* 0xA4 */ {0x02, 0xC2, 0xA4, 0x00}, /* 0xA5 */ {0x02, 0xC4, 0xBD, 0x00}, /* 0xA6 */ {0x02, 0xC5, 0x9A, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xA7, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xA9 */ {0x02, 0xC5, 0xA0, 0x00}, /* 0xAA */ {0x02, 0xC5, 0x9E, 0x00}, /* 0xAB */ {0x02, 0xC5, 0xA4, 0x00}, /* 0xAC */ {0x02, 0xC5, 0xB9, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xAE */ {0x02, 0xC5, 0xBD, 0x00}, /* 0xAF */ {0x02, 0xC5, 0xBB, 0x00},
+    /* 0xB0 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xB1 */ {0x02, 0xC4, 0x85, 0x00}, /* 0xB2 */ {0x02, 0xCB, 0x9B, 0x00}, /* 0xB3 */ {0x02, 0xC5, 0x82, 0x00}, /* 0xB4 */ {0x02, 0xC2, 0xB4, 0x00}, /* 0xB5 */ {0x02, 0xC4, 0xBE, 0x00}, /* 0xB6 */ {0x02, 0xC5, 0x9B, 0x00}, /* 0xB7 */ {0x02, 0xCB, 0x87, 0x00},
+    /* 0xB8 */ {0x02, 0xC2, 0xB8, 0x00}, /* 0xB9 */ {0x02, 0xC5, 0xA1, 0x00}, /* 0xBA */ {0x02, 0xC5, 0x9F, 0x00}, /* 0xBB */ {0x02, 0xC5, 0xA5, 0x00}, /* 0xBC */ {0x02, 0xC5, 0xBA, 0x00}, /* 0xBD */ {0x02, 0xCB, 0x9D, 0x00}, /* 0xBE */ {0x02, 0xC5, 0xBE, 0x00}, /* 0xBF */ {0x02, 0xC5, 0xBC, 0x00},
+    /* 0xC0 */ {0x02, 0xC5, 0x94, 0x00}, /* 0xC1 */ {0x02, 0xC3, 0x81, 0x00}, /* 0xC2 */ {0x02, 0xC3, 0x82, 0x00}, /* 0xC3 */ {0x02, 0xC4, 0x82, 0x00}, /* 0xC4 */ {0x02, 0xC3, 0x84, 0x00}, /* 0xC5 */ {0x02, 0xC4, 0xB9, 0x00}, /* 0xC6 */ {0x02, 0xC4, 0x86, 0x00}, /* 0xC7 */ {0x02, 0xC3, 0x87, 0x00},
+    /* 0xC8 */ {0x02, 0xC4, 0x8C, 0x00}, /* 0xC9 */ {0x02, 0xC3, 0x89, 0x00}, /* 0xCA */ {0x02, 0xC4, 0x98, 0x00}, /* 0xCB */ {0x02, 0xC3, 0x8B, 0x00}, /* 0xCC */ {0x02, 0xC4, 0x9A, 0x00}, /* 0xCD */ {0x02, 0xC3, 0x8D, 0x00}, /* 0xCE */ {0x02, 0xC3, 0x8E, 0x00}, /* 0xCF */ {0x02, 0xC4, 0x8E, 0x00},
+    /* 0xD0 */ {0x02, 0xC4, 0x90, 0x00}, /* 0xD1 */ {0x02, 0xC5, 0x83, 0x00}, /* 0xD2 */ {0x02, 0xC5, 0x87, 0x00}, /* 0xD3 */ {0x02, 0xC3, 0x93, 0x00}, /* 0xD4 */ {0x02, 0xC3, 0x94, 0x00}, /* 0xD5 */ {0x02, 0xC5, 0x90, 0x00}, /* 0xD6 */ {0x02, 0xC3, 0x96, 0x00}, /* 0xD7 */ {0x02, 0xC3, 0x97, 0x00},
+    /* 0xD8 */ {0x02, 0xC5, 0x98, 0x00}, /* 0xD9 */ {0x02, 0xC5, 0xAE, 0x00}, /* 0xDA */ {0x02, 0xC3, 0x9A, 0x00}, /* 0xDB */ {0x02, 0xC5, 0xB0, 0x00}, /* 0xDC */ {0x02, 0xC3, 0x9C, 0x00}, /* 0xDD */ {0x02, 0xC3, 0x9D, 0x00}, /* 0xDE */ {0x02, 0xC5, 0xA2, 0x00}, /* 0xDF */ {0x02, 0xC3, 0x9F, 0x00},
+    /* 0xE0 */ {0x02, 0xC5, 0x95, 0x00}, /* 0xE1 */ {0x02, 0xC3, 0xA1, 0x00}, /* 0xE2 */ {0x02, 0xC3, 0xA2, 0x00}, /* 0xE3 */ {0x02, 0xC4, 0x83, 0x00}, /* 0xE4 */ {0x02, 0xC3, 0xA4, 0x00}, /* 0xE5 */ {0x02, 0xC4, 0xBA, 0x00}, /* 0xE6 */ {0x02, 0xC4, 0x87, 0x00}, /* 0xE7 */ {0x02, 0xC3, 0xA7, 0x00},
+    /* 0xE8 */ {0x02, 0xC4, 0x8D, 0x00}, /* 0xE9 */ {0x02, 0xC3, 0xA9, 0x00}, /* 0xEA */ {0x02, 0xC4, 0x99, 0x00}, /* 0xEB */ {0x02, 0xC3, 0xAB, 0x00}, /* 0xEC */ {0x02, 0xC4, 0x9B, 0x00}, /* 0xED */ {0x02, 0xC3, 0xAD, 0x00}, /* 0xEE */ {0x02, 0xC3, 0xAE, 0x00}, /* 0xEF */ {0x02, 0xC4, 0x8F, 0x00},
+    /* 0xF0 */ {0x02, 0xC4, 0x91, 0x00}, /* 0xF1 */ {0x02, 0xC5, 0x84, 0x00}, /* 0xF2 */ {0x02, 0xC5, 0x88, 0x00}, /* 0xF3 */ {0x02, 0xC3, 0xB3, 0x00}, /* 0xF4 */ {0x02, 0xC3, 0xB4, 0x00}, /* 0xF5 */ {0x02, 0xC5, 0x91, 0x00}, /* 0xF6 */ {0x02, 0xC3, 0xB6, 0x00}, /* 0xF7 */ {0x02, 0xC3, 0xB7, 0x00},
+    /* 0xF8 */ {0x02, 0xC5, 0x99, 0x00}, /* 0xF9 */ {0x02, 0xC5, 0xAF, 0x00}, /* 0xFA */ {0x02, 0xC3, 0xBA, 0x00}, /* 0xFB */ {0x02, 0xC5, 0xB1, 0x00}, /* 0xFC */ {0x02, 0xC3, 0xBC, 0x00}, /* 0xFD */ {0x02, 0xC3, 0xBD, 0x00}, /* 0xFE */ {0x02, 0xC5, 0xA3, 0x00}, /* 0xFF */ {0x02, 0xCB, 0x99, 0x00},
 };
 
-const char* CharConverter::cp866_to_utf8[128] = {
-    /* 0x80 */ "\xD0\x90", /* 0x81 */ "\xD0\x91", /* 0x82 */ "\xD0\x92", /* 0x83 */ "\xD0\x93", /* 0x84 */ "\xD0\x94", /* 0x85 */ "\xD0\x95", /* 0x86 */ "\xD0\x96", /* 0x87 */ "\xD0\x97", /* 0x88 */ "\xD0\x98", /* 0x89 */ "\xD0\x99",
-    /* 0x8A */ "\xD0\x9A", /* 0x8B */ "\xD0\x9B", /* 0x8C */ "\xD0\x9C", /* 0x8D */ "\xD0\x9D", /* 0x8E */ "\xD0\x9E", /* 0x8F */ "\xD0\x9F", /* 0x90 */ "\xD0\xA0", /* 0x91 */ "\xD0\xA1", /* 0x92 */ "\xD0\xA2", /* 0x93 */ "\xD0\xA3",
-    /* 0x94 */ "\xD0\xA4", /* 0x95 */ "\xD0\xA5", /* 0x96 */ "\xD0\xA6", /* 0x97 */ "\xD0\xA7", /* 0x98 */ "\xD0\xA8", /* 0x99 */ "\xD0\xA9", /* 0x9A */ "\xD0\xAA", /* 0x9B */ "\xD0\xAB", /* 0x9C */ "\xD0\xAC", /* 0x9D */ "\xD0\xAD",
-    /* 0x9E */ "\xD0\xAE", /* 0x9F */ "\xD0\xAF", /* 0xA0 */ "\xD0\xB0", /* 0xA1 */ "\xD0\xB1", /* 0xA2 */ "\xD0\xB2", /* 0xA3 */ "\xD0\xB3", /* 0xA4 */ "\xD0\xB4", /* 0xA5 */ "\xD0\xB5", /* 0xA6 */ "\xD0\xB6", /* 0xA7 */ "\xD0\xB7",
-    /* 0xA8 */ "\xD0\xB8", /* 0xA9 */ "\xD0\xB9", /* 0xAA */ "\xD0\xBA", /* 0xAB */ "\xD0\xBB", /* 0xAC */ "\xD0\xBC", /* 0xAD */ "\xD0\xBD", /* 0xAE */ "\xD0\xBE", /* 0xAF */ "\xD0\xBF", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xE2\x95\xA1", /* 0xB6 */ "\xE2\x95\xA2", /* 0xB7 */ "\xE2\x95\x96", /* 0xB8 */ "\xE2\x95\x95", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xE2\x95\x9C", /* 0xBE */ "\xE2\x95\x9B", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xE2\x95\x9E", /* 0xC7 */ "\xE2\x95\x9F", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xE2\x95\xA7", /* 0xD0 */ "\xE2\x95\xA8", /* 0xD1 */ "\xE2\x95\xA4", /* 0xD2 */ "\xE2\x95\xA5", /* 0xD3 */ "\xE2\x95\x99", /* 0xD4 */ "\xE2\x95\x98", /* 0xD5 */ "\xE2\x95\x92",
-    /* 0xD6 */ "\xE2\x95\x93", /* 0xD7 */ "\xE2\x95\xAB", /* 0xD8 */ "\xE2\x95\xAA", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xE2\x96\x8C", /* 0xDE */ "\xE2\x96\x90",
-    /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xD1\x80", /* 0xE1 */ "\xD1\x81", /* 0xE2 */ "\xD1\x82", /* 0xE3 */ "\xD1\x83", /* 0xE4 */ "\xD1\x84", /* 0xE5 */ "\xD1\x85", /* 0xE6 */ "\xD1\x86", /* 0xE7 */ "\xD1\x87", /* 0xE8 */ "\xD1\x88",
-    /* 0xE9 */ "\xD1\x89", /* 0xEA */ "\xD1\x8A", /* 0xEB */ "\xD1\x8B", /* 0xEC */ "\xD1\x8C", /* 0xED */ "\xD1\x8D", /* 0xEE */ "\xD1\x8E", /* 0xEF */ "\xD1\x8F", /* 0xF0 */ "\xD0\x81", /* 0xF1 */ "\xD1\x91", /* 0xF2 */ "\xD0\x84",
-    /* 0xF3 */ "\xD1\x94", /* 0xF4 */ "\xD0\x87", /* 0xF5 */ "\xD1\x97", /* 0xF6 */ "\xD0\x8E", /* 0xF7 */ "\xD1\x9E", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xE2\x88\x99", /* 0xFA */ "\xC2\xB7", /* 0xFB */ "\xE2\x88\x9A", /* 0xFC */ "\xE2\x84\x96",
-    /* 0xFD */ "\xC2\xA4", /* 0xFE */ "\xE2\x96\xA0", /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::iso8859_5_to_utf8[128] = {
+    /* 0x80 */ {0x00, 0x00, 0x00, 0x00}, /* 0x81 */ {0x00, 0x00, 0x00, 0x00}, /* 0x82 */ {0x00, 0x00, 0x00, 0x00}, /* 0x83 */ {0x00, 0x00, 0x00, 0x00}, /* 0x84 */ {0x00, 0x00, 0x00, 0x00}, /* 0x85 */ {0x00, 0x00, 0x00, 0x00}, /* 0x86 */ {0x00, 0x00, 0x00, 0x00}, /* 0x87 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x88 */ {0x00, 0x00, 0x00, 0x00}, /* 0x89 */ {0x00, 0x00, 0x00, 0x00}, /* 0x8A */ {0x00, 0x00, 0x00, 0x00}, /* 0x8B */ {0x00, 0x00, 0x00, 0x00}, /* 0x8C */ {0x00, 0x00, 0x00, 0x00}, /* 0x8D */ {0x00, 0x00, 0x00, 0x00}, /* 0x8E */ {0x00, 0x00, 0x00, 0x00}, /* 0x8F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x90 */ {0x00, 0x00, 0x00, 0x00}, /* 0x91 */ {0x00, 0x00, 0x00, 0x00}, /* 0x92 */ {0x00, 0x00, 0x00, 0x00}, /* 0x93 */ {0x00, 0x00, 0x00, 0x00}, /* 0x94 */ {0x00, 0x00, 0x00, 0x00}, /* 0x95 */ {0x00, 0x00, 0x00, 0x00}, /* 0x96 */ {0x00, 0x00, 0x00, 0x00}, /* 0x97 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x98 */ {0x00, 0x00, 0x00, 0x00}, /* 0x99 */ {0x00, 0x00, 0x00, 0x00}, /* 0x9A */ {0x00, 0x00, 0x00, 0x00}, /* 0x9B */ {0x00, 0x00, 0x00, 0x00}, /* 0x9C */ {0x00, 0x00, 0x00, 0x00}, /* 0x9D */ {0x00, 0x00, 0x00, 0x00}, /* 0x9E */ {0x00, 0x00, 0x00, 0x00}, /* 0x9F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0xA0 */ {0x02, 0xC2, 0xA0, 0x00}, /* 0xA1 */ {0x02, 0xD0, 0x81, 0x00}, /* 0xA2 */ {0x02, 0xD0, 0x82, 0x00}, /* 0xA3 */ {0x02, 0xD0, 0x83, 0x00}, /* 0xA4 */ {0x02, 0xD0, 0x84, 0x00}, /* 0xA5 */ {0x02, 0xD0, 0x85, 0x00}, /* 0xA6 */ {0x02, 0xD0, 0x86, 0x00}, /* 0xA7 */ {0x02, 0xD0, 0x87, 0x00},
+    /* 0xA8 */ {0x02, 0xD0, 0x88, 0x00}, /* 0xA9 */ {0x02, 0xD0, 0x89, 0x00}, /* 0xAA */ {0x02, 0xD0, 0x8A, 0x00}, /* 0xAB */ {0x02, 0xD0, 0x8B, 0x00}, /* 0xAC */ {0x02, 0xD0, 0x8C, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xAE */ {0x02, 0xD0, 0x8E, 0x00}, /* 0xAF */ {0x02, 0xD0, 0x8F, 0x00},
+    /* 0xB0 */ {0x02, 0xD0, 0x90, 0x00}, /* 0xB1 */ {0x02, 0xD0, 0x91, 0x00}, /* 0xB2 */ {0x02, 0xD0, 0x92, 0x00}, /* 0xB3 */ {0x02, 0xD0, 0x93, 0x00}, /* 0xB4 */ {0x02, 0xD0, 0x94, 0x00}, /* 0xB5 */ {0x02, 0xD0, 0x95, 0x00}, /* 0xB6 */ {0x02, 0xD0, 0x96, 0x00}, /* 0xB7 */ {0x02, 0xD0, 0x97, 0x00},
+    /* 0xB8 */ {0x02, 0xD0, 0x98, 0x00}, /* 0xB9 */ {0x02, 0xD0, 0x99, 0x00}, /* 0xBA */ {0x02, 0xD0, 0x9A, 0x00}, /* 0xBB */ {0x02, 0xD0, 0x9B, 0x00}, /* 0xBC */ {0x02, 0xD0, 0x9C, 0x00}, /* 0xBD */ {0x02, 0xD0, 0x9D, 0x00}, /* 0xBE */ {0x02, 0xD0, 0x9E, 0x00}, /* 0xBF */ {0x02, 0xD0, 0x9F, 0x00},
+    /* 0xC0 */ {0x02, 0xD0, 0xA0, 0x00}, /* 0xC1 */ {0x02, 0xD0, 0xA1, 0x00}, /* 0xC2 */ {0x02, 0xD0, 0xA2, 0x00}, /* 0xC3 */ {0x02, 0xD0, 0xA3, 0x00}, /* 0xC4 */ {0x02, 0xD0, 0xA4, 0x00}, /* 0xC5 */ {0x02, 0xD0, 0xA5, 0x00}, /* 0xC6 */ {0x02, 0xD0, 0xA6, 0x00}, /* 0xC7 */ {0x02, 0xD0, 0xA7, 0x00},
+    /* 0xC8 */ {0x02, 0xD0, 0xA8, 0x00}, /* 0xC9 */ {0x02, 0xD0, 0xA9, 0x00}, /* 0xCA */ {0x02, 0xD0, 0xAA, 0x00}, /* 0xCB */ {0x02, 0xD0, 0xAB, 0x00}, /* 0xCC */ {0x02, 0xD0, 0xAC, 0x00}, /* 0xCD */ {0x02, 0xD0, 0xAD, 0x00}, /* 0xCE */ {0x02, 0xD0, 0xAE, 0x00}, /* 0xCF */ {0x02, 0xD0, 0xAF, 0x00},
+    /* 0xD0 */ {0x02, 0xD0, 0xB0, 0x00}, /* 0xD1 */ {0x02, 0xD0, 0xB1, 0x00}, /* 0xD2 */ {0x02, 0xD0, 0xB2, 0x00}, /* 0xD3 */ {0x02, 0xD0, 0xB3, 0x00}, /* 0xD4 */ {0x02, 0xD0, 0xB4, 0x00}, /* 0xD5 */ {0x02, 0xD0, 0xB5, 0x00}, /* 0xD6 */ {0x02, 0xD0, 0xB6, 0x00}, /* 0xD7 */ {0x02, 0xD0, 0xB7, 0x00},
+    /* 0xD8 */ {0x02, 0xD0, 0xB8, 0x00}, /* 0xD9 */ {0x02, 0xD0, 0xB9, 0x00}, /* 0xDA */ {0x02, 0xD0, 0xBA, 0x00}, /* 0xDB */ {0x02, 0xD0, 0xBB, 0x00}, /* 0xDC */ {0x02, 0xD0, 0xBC, 0x00}, /* 0xDD */ {0x02, 0xD0, 0xBD, 0x00}, /* 0xDE */ {0x02, 0xD0, 0xBE, 0x00}, /* 0xDF */ {0x02, 0xD0, 0xBF, 0x00},
+    /* 0xE0 */ {0x02, 0xD1, 0x80, 0x00}, /* 0xE1 */ {0x02, 0xD1, 0x81, 0x00}, /* 0xE2 */ {0x02, 0xD1, 0x82, 0x00}, /* 0xE3 */ {0x02, 0xD1, 0x83, 0x00}, /* 0xE4 */ {0x02, 0xD1, 0x84, 0x00}, /* 0xE5 */ {0x02, 0xD1, 0x85, 0x00}, /* 0xE6 */ {0x02, 0xD1, 0x86, 0x00}, /* 0xE7 */ {0x02, 0xD1, 0x87, 0x00},
+    /* 0xE8 */ {0x02, 0xD1, 0x88, 0x00}, /* 0xE9 */ {0x02, 0xD1, 0x89, 0x00}, /* 0xEA */ {0x02, 0xD1, 0x8A, 0x00}, /* 0xEB */ {0x02, 0xD1, 0x8B, 0x00}, /* 0xEC */ {0x02, 0xD1, 0x8C, 0x00}, /* 0xED */ {0x02, 0xD1, 0x8D, 0x00}, /* 0xEE */ {0x02, 0xD1, 0x8E, 0x00}, /* 0xEF */ {0x02, 0xD1, 0x8F, 0x00},
+    /* 0xF0 */ {0x03, 0xE2, 0x84, 0x96}, /* 0xF1 */ {0x02, 0xD1, 0x91, 0x00}, /* 0xF2 */ {0x02, 0xD1, 0x92, 0x00}, /* 0xF3 */ {0x02, 0xD1, 0x93, 0x00}, /* 0xF4 */ {0x02, 0xD1, 0x94, 0x00}, /* 0xF5 */ {0x02, 0xD1, 0x95, 0x00}, /* 0xF6 */ {0x02, 0xD1, 0x96, 0x00}, /* 0xF7 */ {0x02, 0xD1, 0x97, 0x00},
+    /* 0xF8 */ {0x02, 0xD1, 0x98, 0x00}, /* 0xF9 */ {0x02, 0xD1, 0x99, 0x00}, /* 0xFA */ {0x02, 0xD1, 0x9A, 0x00}, /* 0xFB */ {0x02, 0xD1, 0x9B, 0x00}, /* 0xFC */ {0x02, 0xD1, 0x9C, 0x00}, /* 0xFD */ {0x02, 0xC2, 0xA7, 0x00}, /* 0xFE */ {0x02, 0xD1, 0x9E, 0x00}, /* 0xFF */ {0x02, 0xD1, 0x9F, 0x00},
 };
 
-const char* CharConverter::cp737_to_utf8[128] = {
-    /* 0x80 */ "\xCE\x91", /* 0x81 */ "\xCE\x92", /* 0x82 */ "\xCE\x93", /* 0x83 */ "\xCE\x94", /* 0x84 */ "\xCE\x95", /* 0x85 */ "\xCE\x96", /* 0x86 */ "\xCE\x97", /* 0x87 */ "\xCE\x98", /* 0x88 */ "\xCE\x99", /* 0x89 */ "\xCE\x9A",
-    /* 0x8A */ "\xCE\x9B", /* 0x8B */ "\xCE\x9C", /* 0x8C */ "\xCE\x9D", /* 0x8D */ "\xCE\x9E", /* 0x8E */ "\xCE\x9F", /* 0x8F */ "\xCE\xA0", /* 0x90 */ "\xCE\xA1", /* 0x91 */ "\xCE\xA3", /* 0x92 */ "\xCE\xA4", /* 0x93 */ "\xCE\xA5",
-    /* 0x94 */ "\xCE\xA6", /* 0x95 */ "\xCE\xA7", /* 0x96 */ "\xCE\xA8", /* 0x97 */ "\xCE\xA9", /* 0x98 */ "\xCE\xB1", /* 0x99 */ "\xCE\xB2", /* 0x9A */ "\xCE\xB3", /* 0x9B */ "\xCE\xB4", /* 0x9C */ "\xCE\xB5", /* 0x9D */ "\xCE\xB6",
-    /* 0x9E */ "\xCE\xB7", /* 0x9F */ "\xCE\xB8", /* 0xA0 */ "\xCE\xB9", /* 0xA1 */ "\xCE\xBA", /* 0xA2 */ "\xCE\xBB", /* 0xA3 */ "\xCE\xBC", /* 0xA4 */ "\xCE\xBD", /* 0xA5 */ "\xCE\xBE", /* 0xA6 */ "\xCE\xBF", /* 0xA7 */ "\xCF\x80",
-    /* 0xA8 */ "\xCF\x81", /* 0xA9 */ "\xCF\x83", /* 0xAA */ "\xCF\x82", /* 0xAB */ "\xCF\x84", /* 0xAC */ "\xCF\x85", /* 0xAD */ "\xCF\x86", /* 0xAE */ "\xCF\x87", /* 0xAF */ "\xCF\x88", /* 0xB0 */ "\xE2\x96\x91", /* 0xB1 */ "\xE2\x96\x92",
-    /* 0xB2 */ "\xE2\x96\x93", /* 0xB3 */ "\xE2\x94\x82", /* 0xB4 */ "\xE2\x94\xA4", /* 0xB5 */ "\xE2\x95\xA1", /* 0xB6 */ "\xE2\x95\xA2", /* 0xB7 */ "\xE2\x95\x96", /* 0xB8 */ "\xE2\x95\x95", /* 0xB9 */ "\xE2\x95\xA3", /* 0xBA */ "\xE2\x95\x91",
-    /* 0xBB */ "\xE2\x95\x97", /* 0xBC */ "\xE2\x95\x9D", /* 0xBD */ "\xE2\x95\x9C", /* 0xBE */ "\xE2\x95\x9B", /* 0xBF */ "\xE2\x94\x90", /* 0xC0 */ "\xE2\x94\x94", /* 0xC1 */ "\xE2\x94\xB4", /* 0xC2 */ "\xE2\x94\xAC", /* 0xC3 */ "\xE2\x94\x9C",
-    /* 0xC4 */ "\xE2\x94\x80", /* 0xC5 */ "\xE2\x94\xBC", /* 0xC6 */ "\xE2\x95\x9E", /* 0xC7 */ "\xE2\x95\x9F", /* 0xC8 */ "\xE2\x95\x9A", /* 0xC9 */ "\xE2\x95\x94", /* 0xCA */ "\xE2\x95\xA9", /* 0xCB */ "\xE2\x95\xA6", /* 0xCC */ "\xE2\x95\xA0",
-    /* 0xCD */ "\xE2\x95\x90", /* 0xCE */ "\xE2\x95\xAC", /* 0xCF */ "\xE2\x95\xA7", /* 0xD0 */ "\xE2\x95\xA8", /* 0xD1 */ "\xE2\x95\xA4", /* 0xD2 */ "\xE2\x95\xA5", /* 0xD3 */ "\xE2\x95\x99", /* 0xD4 */ "\xE2\x95\x98", /* 0xD5 */ "\xE2\x95\x92",
-    /* 0xD6 */ "\xE2\x95\x93", /* 0xD7 */ "\xE2\x95\xAB", /* 0xD8 */ "\xE2\x95\xAA", /* 0xD9 */ "\xE2\x94\x98", /* 0xDA */ "\xE2\x94\x8C", /* 0xDB */ "\xE2\x96\x88", /* 0xDC */ "\xE2\x96\x84", /* 0xDD */ "\xE2\x96\x8C", /* 0xDE */ "\xE2\x96\x90",
-    /* 0xDF */ "\xE2\x96\x80", /* 0xE0 */ "\xCF\x89", /* 0xE1 */ "\xCE\xAC", /* 0xE2 */ "\xCE\xAD", /* 0xE3 */ "\xCE\xAE", /* 0xE4 */ "\xCF\x8A", /* 0xE5 */ "\xCE\xAF", /* 0xE6 */ "\xCF\x8C", /* 0xE7 */ "\xCF\x8D", /* 0xE8 */ "\xCF\x8B",
-    /* 0xE9 */ "\xCF\x8E", /* 0xEA */ "\xCE\x86", /* 0xEB */ "\xCE\x88", /* 0xEC */ "\xCE\x89", /* 0xED */ "\xCE\x8A", /* 0xEE */ "\xCE\x8C", /* 0xEF */ "\xCE\x8E", /* 0xF0 */ "\xCE\x8F", /* 0xF1 */ "\xC2\xB1", /* 0xF2 */ "\xE2\x89\xA5",
-    /* 0xF3 */ "\xE2\x89\xA4", /* 0xF4 */ "\xCE\xAA", /* 0xF5 */ "\xCE\xAB", /* 0xF6 */ "\xC3\xB7", /* 0xF7 */ "\xE2\x89\x88", /* 0xF8 */ "\xC2\xB0", /* 0xF9 */ "\xE2\x88\x99", /* 0xFA */ "\xC2\xB7", /* 0xFB */ "\xE2\x88\x9A", /* 0xFC */ "\xE2\x81\xBF",
-    /* 0xFD */ "\xC2\xB2", /* 0xFE */ "\xE2\x96\xA0", /* 0xFF */ "\xC2\xA0",
+const CharConverter::Utf8Entry CharConverter::iso8859_7_to_utf8[128] = {
+    /* 0x80 */ {0x00, 0x00, 0x00, 0x00}, /* 0x81 */ {0x00, 0x00, 0x00, 0x00}, /* 0x82 */ {0x00, 0x00, 0x00, 0x00}, /* 0x83 */ {0x00, 0x00, 0x00, 0x00}, /* 0x84 */ {0x00, 0x00, 0x00, 0x00}, /* 0x85 */ {0x00, 0x00, 0x00, 0x00}, /* 0x86 */ {0x00, 0x00, 0x00, 0x00}, /* 0x87 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x88 */ {0x00, 0x00, 0x00, 0x00}, /* 0x89 */ {0x00, 0x00, 0x00, 0x00}, /* 0x8A */ {0x00, 0x00, 0x00, 0x00}, /* 0x8B */ {0x00, 0x00, 0x00, 0x00}, /* 0x8C */ {0x00, 0x00, 0x00, 0x00}, /* 0x8D */ {0x00, 0x00, 0x00, 0x00}, /* 0x8E */ {0x00, 0x00, 0x00, 0x00}, /* 0x8F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x90 */ {0x00, 0x00, 0x00, 0x00}, /* 0x91 */ {0x00, 0x00, 0x00, 0x00}, /* 0x92 */ {0x00, 0x00, 0x00, 0x00}, /* 0x93 */ {0x00, 0x00, 0x00, 0x00}, /* 0x94 */ {0x00, 0x00, 0x00, 0x00}, /* 0x95 */ {0x00, 0x00, 0x00, 0x00}, /* 0x96 */ {0x00, 0x00, 0x00, 0x00}, /* 0x97 */ {0x00, 0x00, 0x00, 0x00},
+    /* 0x98 */ {0x00, 0x00, 0x00, 0x00}, /* 0x99 */ {0x00, 0x00, 0x00, 0x00}, /* 0x9A */ {0x00, 0x00, 0x00, 0x00}, /* 0x9B */ {0x00, 0x00, 0x00, 0x00}, /* 0x9C */ {0x00, 0x00, 0x00, 0x00}, /* 0x9D */ {0x00, 0x00, 0x00, 0x00}, /* 0x9E */ {0x00, 0x00, 0x00, 0x00}, /* 0x9F */ {0x00, 0x00, 0x00, 0x00},
+    /* 0xA0 */ {0x02, 0xC2, 0xA0, 0x00}, /* 0xA1 */ {0x03, 0xE2, 0x80, 0x98}, /* 0xA2 */ {0x03, 0xE2, 0x80, 0x99}, /* 0xA3 */ {0x02, 0xC2, 0xA3, 0x00}, /* 0xA4 */ {0x03, 0xE2, 0x82, 0xAC}, /* 0xA5 */ {0x03, 0xE2, 0x82, 0xAF}, /* 0xA6 */ {0x02, 0xC2, 0xA6, 0x00}, /* 0xA7 */ {0x02, 0xC2, 0xA7, 0x00},
+    /* 0xA8 */ {0x02, 0xC2, 0xA8, 0x00}, /* 0xA9 */ {0x02, 0xC2, 0xA9, 0x00}, /* 0xAA */ {0x02, 0xCD, 0xBA, 0x00}, /* 0xAB */ {0x02, 0xC2, 0xAB, 0x00}, /* 0xAC */ {0x02, 0xC2, 0xAC, 0x00}, /* 0xAD */ {0x02, 0xC2, 0xAD, 0x00}, /* 0xAE */ {0x00, 0x00, 0x00, 0x00}, /* 0xAF */ {0x03, 0xE2, 0x80, 0x95},
+    /* 0xB0 */ {0x02, 0xC2, 0xB0, 0x00}, /* 0xB1 */ {0x02, 0xC2, 0xB1, 0x00}, /* 0xB2 */ {0x02, 0xC2, 0xB2, 0x00}, /* 0xB3 */ {0x02, 0xC2, 0xB3, 0x00}, /* 0xB4 */ {0x02, 0xCE, 0x84, 0x00}, /* 0xB5 */ {0x02, 0xCE, 0x85, 0x00}, /* 0xB6 */ {0x02, 0xCE, 0x86, 0x00}, /* 0xB7 */ {0x02, 0xC2, 0xB7, 0x00},
+    /* 0xB8 */ {0x02, 0xCE, 0x88, 0x00}, /* 0xB9 */ {0x02, 0xCE, 0x89, 0x00}, /* 0xBA */ {0x02, 0xCE, 0x8A, 0x00}, /* 0xBB */ {0x02, 0xC2, 0xBB, 0x00}, /* 0xBC */ {0x02, 0xCE, 0x8C, 0x00}, /* 0xBD */ {0x02, 0xC2, 0xBD, 0x00}, /* 0xBE */ {0x02, 0xCE, 0x8E, 0x00}, /* 0xBF */ {0x02, 0xCE, 0x8F, 0x00},
+    /* 0xC0 */ {0x02, 0xCE, 0x90, 0x00}, /* 0xC1 */ {0x02, 0xCE, 0x91, 0x00}, /* 0xC2 */ {0x02, 0xCE, 0x92, 0x00}, /* 0xC3 */ {0x02, 0xCE, 0x93, 0x00}, /* 0xC4 */ {0x02, 0xCE, 0x94, 0x00}, /* 0xC5 */ {0x02, 0xCE, 0x95, 0x00}, /* 0xC6 */ {0x02, 0xCE, 0x96, 0x00}, /* 0xC7 */ {0x02, 0xCE, 0x97, 0x00},
+    /* 0xC8 */ {0x02, 0xCE, 0x98, 0x00}, /* 0xC9 */ {0x02, 0xCE, 0x99, 0x00}, /* 0xCA */ {0x02, 0xCE, 0x9A, 0x00}, /* 0xCB */ {0x02, 0xCE, 0x9B, 0x00}, /* 0xCC */ {0x02, 0xCE, 0x9C, 0x00}, /* 0xCD */ {0x02, 0xCE, 0x9D, 0x00}, /* 0xCE */ {0x02, 0xCE, 0x9E, 0x00}, /* 0xCF */ {0x02, 0xCE, 0x9F, 0x00},
+    /* 0xD0 */ {0x02, 0xCE, 0xA0, 0x00}, /* 0xD1 */ {0x02, 0xCE, 0xA1, 0x00}, /* 0xD2 */ {0x00, 0x00, 0x00, 0x00}, /* 0xD3 */ {0x02, 0xCE, 0xA3, 0x00}, /* 0xD4 */ {0x02, 0xCE, 0xA4, 0x00}, /* 0xD5 */ {0x02, 0xCE, 0xA5, 0x00}, /* 0xD6 */ {0x02, 0xCE, 0xA6, 0x00}, /* 0xD7 */ {0x02, 0xCE, 0xA7, 0x00},
+    /* 0xD8 */ {0x02, 0xCE, 0xA8, 0x00}, /* 0xD9 */ {0x02, 0xCE, 0xA9, 0x00}, /* 0xDA */ {0x02, 0xCE, 0xAA, 0x00}, /* 0xDB */ {0x02, 0xCE, 0xAB, 0x00}, /* 0xDC */ {0x02, 0xCE, 0xAC, 0x00}, /* 0xDD */ {0x02, 0xCE, 0xAD, 0x00}, /* 0xDE */ {0x02, 0xCE, 0xAE, 0x00}, /* 0xDF */ {0x02, 0xCE, 0xAF, 0x00},
+    /* 0xE0 */ {0x02, 0xCE, 0xB0, 0x00}, /* 0xE1 */ {0x02, 0xCE, 0xB1, 0x00}, /* 0xE2 */ {0x02, 0xCE, 0xB2, 0x00}, /* 0xE3 */ {0x02, 0xCE, 0xB3, 0x00}, /* 0xE4 */ {0x02, 0xCE, 0xB4, 0x00}, /* 0xE5 */ {0x02, 0xCE, 0xB5, 0x00}, /* 0xE6 */ {0x02, 0xCE, 0xB6, 0x00}, /* 0xE7 */ {0x02, 0xCE, 0xB7, 0x00},
+    /* 0xE8 */ {0x02, 0xCE, 0xB8, 0x00}, /* 0xE9 */ {0x02, 0xCE, 0xB9, 0x00}, /* 0xEA */ {0x02, 0xCE, 0xBA, 0x00}, /* 0xEB */ {0x02, 0xCE, 0xBB, 0x00}, /* 0xEC */ {0x02, 0xCE, 0xBC, 0x00}, /* 0xED */ {0x02, 0xCE, 0xBD, 0x00}, /* 0xEE */ {0x02, 0xCE, 0xBE, 0x00}, /* 0xEF */ {0x02, 0xCE, 0xBF, 0x00},
+    /* 0xF0 */ {0x02, 0xCF, 0x80, 0x00}, /* 0xF1 */ {0x02, 0xCF, 0x81, 0x00}, /* 0xF2 */ {0x02, 0xCF, 0x82, 0x00}, /* 0xF3 */ {0x02, 0xCF, 0x83, 0x00}, /* 0xF4 */ {0x02, 0xCF, 0x84, 0x00}, /* 0xF5 */ {0x02, 0xCF, 0x85, 0x00}, /* 0xF6 */ {0x02, 0xCF, 0x86, 0x00}, /* 0xF7 */ {0x02, 0xCF, 0x87, 0x00},
+    /* 0xF8 */ {0x02, 0xCF, 0x88, 0x00}, /* 0xF9 */ {0x02, 0xCF, 0x89, 0x00}, /* 0xFA */ {0x02, 0xCF, 0x8A, 0x00}, /* 0xFB */ {0x02, 0xCF, 0x8B, 0x00}, /* 0xFC */ {0x02, 0xCF, 0x8C, 0x00}, /* 0xFD */ {0x02, 0xCF, 0x8D, 0x00}, /* 0xFE */ {0x02, 0xCF, 0x8E, 0x00}, /* 0xFF */ {0x00, 0x00, 0x00, 0x00},
 };
 // clang-format on
 
@@ -25,7 +25,10 @@
 #ifndef CHARCONV_HPP
 #define CHARCONV_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace charconv {
 
@@ -38,23 +41,123 @@ class CharConverter {
     // Constructor to set the codepage (default to CP437)
     explicit CharConverter(uint16_t codepage = 437);
 
-    // Method to convert a string from the current codepage to UTF-8
-    void CharConverter::convert(const char* input, char* utf8TextPtr, size_t bufferSize) const;
+    // Method to convert a string from the current codepage to UTF-8 into the given buffer. Returns
+    // the number of bytes written without the terminating NUL. If utf8TextPtr is NULL nothing is
+    // written and the required length (without the terminating NUL) is returned.
+    size_t convert(const char* input, char* utf8TextPtr, size_t bufferSize) const;
+
+    // Methods to append the UTF-8 conversion of a string to the given string or byte vector
+    void convert(const char* input, std::string& utf8Text) const;
+    void convert(const char* input, std::vector<uint8_t>& utf8Bytes) const;
+
+    // Method to convert inputSize bytes (NUL is converted like any other character) into the
+    // given output window. Stops before the first character whose UTF-8 sequence does not fit,
+    // stores the number of input bytes used in consumed and returns the number of bytes written.
+    // If output is NULL nothing is written and the length of the whole conversion is returned.
+    size_t convertChunk(const char* input, size_t inputSize, char* output, size_t outputSize, size_t& consumed) const;
+
+    // Method to translate a string into the first single byte charset with an ECI assignment (ISO 8859-1,
+    // 8859-2, 8859-5, 8859-7, CP437) that has all of its characters, e.g. to store it in a QR code without
+    // expanding it to UTF-8. Returns the ECI assignment value, or -1 if no charset has all characters.
+    long convertToEci(const char* input, std::vector<uint8_t>& output) const;
 
    private:
+    // Helper method to write the UTF-8 conversion without a terminating NUL, returns the
+    // number of bytes. Writes nothing if output is NULL, throws if outputSize is too small.
+    size_t write(const char* input, char* output, size_t outputSize) const;
+
+    // Helper method to count the ASCII characters at the start of the given input
+    static size_t asciiRunLength(const unsigned char* input, size_t length);
+
+    // Translation table entry: length of the UTF-8 sequence followed by up to 3 bytes of it,
+    // so every lookup is a single fixed size 4 byte load
+    typedef uint8_t Utf8Entry[4];
+
+    // Codepage number and its translation table, see the codepages list
+    struct Codepage {
+        uint16_t codepage;
+        const Utf8Entry* table;
+    };
+
     // Pointer to the current translation table
-    const char** translationTable;
+    const Utf8Entry* translationTable;
 
     // Helper method to select the translation table based on the codepage
-    const char** getTranslationTable(uint16_t codepage) const;
+    const Utf8Entry* getTranslationTable(uint16_t codepage) const;
+
+    // Supported codepages, the first entry is the fallback for unknown codepages
+    static const Codepage codepages[];
+    static const size_t numCodepages;
+
+    // ECI assignment value and translation table of a single byte charset
+    struct EciCharset {
+        long assignment;
+        const Utf8Entry* table;
+    };
+
+    // Helper method to map the used characters (by their index in the translation table) to the
+    // bytes of the same characters in the given table, returns false if one is missing
+    bool getEciMapping(const Utf8Entry* table, const bool used[128], uint8_t mapping[128]) const;
+
+    // Charsets for convertToEci in order of preference
+    static const EciCharset eciCharsets[];
+    static const size_t numEciCharsets;
 
     // Translation tables for different codepages (only the last 128 non ASCII characters)
-    static const char* cp437_to_utf8[128];
-    static const char* cp850_to_utf8[128];
-    static const char* cp858_to_utf8[128];
-    static const char* cp852_to_utf8[128];
-    static const char* cp866_to_utf8[128];
-    static const char* cp737_to_utf8[128];
+    static const Utf8Entry cp437_to_utf8[128];
+    static const Utf8Entry cp850_to_utf8[128];
+    static const Utf8Entry cp858_to_utf8[128];
+    static const Utf8Entry cp852_to_utf8[128];
+    static const Utf8Entry cp866_to_utf8[128];
+    static const Utf8Entry cp737_to_utf8[128];
+
+    // Translation tables of the ISO 8859 charsets for convertToEci, C1 controls and unassigned bytes are empty
+    static const Utf8Entry iso8859_1_to_utf8[128];
+    static const Utf8Entry iso8859_2_to_utf8[128];
+    static const Utf8Entry iso8859_5_to_utf8[128];
+    static const Utf8Entry iso8859_7_to_utf8[128];
+};
+
+/*
+ * This class converts input of any length to UTF-8 chunk by chunk, e.g. while reading a file,
+ * without holding the whole input or output in memory. Input chunks can be split at any byte and
+ * the output window can have any size: a UTF-8 sequence that does not fit completely is kept and
+ * written at the start of the next window. Each call reports consumed and produced byte counts.
+ */
+class StreamConverter {
+   public:
+    // Constructor to set the converter for the codepage of the input
+    explicit StreamConverter(const CharConverter& converter);
+
+    // Method to convert as much of the input chunk as fits into the output window. The number of
+    // input bytes used is stored in consumed, the number of bytes written in produced. Input that
+    // was not consumed has to be passed again with the next call.
+    void convert(const char* input, size_t inputSize, char* output, size_t outputSize, size_t& consumed,
+                 size_t& produced);
+
+    // Method to check if bytes of a split UTF-8 sequence are waiting for the next output window,
+    // at the end of the input call convert with an empty chunk until this is false
+    bool hasPending() const;
+
+    // Methods to get the number of bytes consumed and produced since construction or reset
+    unsigned long getTotalConsumed() const;
+    unsigned long getTotalProduced() const;
+
+    // Method to drop pending bytes and reset the counters for a new input
+    void reset();
+
+   private:
+    // Converter for the codepage of the input
+    const CharConverter& converter;
+
+    // Rest of a UTF-8 sequence that did not fit into the last output window
+    char pending[3];
+    size_t pendingStart;
+    size_t pendingEnd;
+
+    // Counters since construction or reset
+    unsigned long totalConsumed;
+    unsigned long totalProduced;
 };
 }  // namespace charconv
 
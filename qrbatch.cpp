@@ -0,0 +1,369 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrbatch.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(QRBATCH_THREADS)
+#include <pthread.h>
+#endif
+
+#include "qrimage.hpp"
+#include "qrtext.hpp"
+
+using qrcodegen::QrCode;
+
+namespace qrbatch {
+#if defined(QRBATCH_THREADS)
+/*
+ * This class runs a batch on a reader thread, a pool of encoder threads and the calling thread as
+ * writer. The stages share a ring of slots, each holding one record from its reading until its image
+ * is written. The reader waits for a free slot, the encoders take the read records in turn and the
+ * writer waits for the next record in input order, so a slow stage holds back the others.
+ */
+class BatchEncoder::Pipeline {
+   public:
+    // Constructor to set up the ring for the given number of encoder threads
+    Pipeline(const BatchEncoder& encoder, FILE* input, unsigned int jobs);
+
+    // Destructor to release the locks
+    ~Pipeline();
+
+    // Method to start the threads and write the images in input order, returns the number of failed records
+    unsigned long run(FILE* output);
+
+   private:
+    // Stages of a slot, in the order a record passes them
+    enum State { EMPTY, READ, ENCODING, ENCODED };
+
+    // One record and its result
+    struct Slot {
+        State state;
+        std::string record;
+        QrCode qr;
+        QrCode::Status status;
+        QrCode::Capacity capacity;
+        bool failed;        // Whether the encoder threw, with the message in error
+        std::string error;
+
+        Slot() : state(EMPTY), status(QrCode::SUCCESS), failed(false) {
+        }
+    };
+
+    // Batch settings and input file
+    const BatchEncoder& encoder;
+    FILE* input;
+    unsigned int jobs;
+
+    // Ring of slots, record n is kept in slot n % size
+    std::vector<Slot> slots;
+
+    // Numbers of records read, taken by an encoder and written
+    unsigned long numRead;
+    unsigned long numTaken;
+    unsigned long numWritten;
+
+    // Set by the reader at the end of the input, with the message of a read error if any
+    bool endOfInput;
+    std::string readError;
+
+    // Set by the writer to end the other threads early
+    bool stopping;
+
+    // Lock of all fields above and the conditions the stages wait for
+    pthread_mutex_t mutex;
+    pthread_cond_t slotFreed;
+    pthread_cond_t recordRead;
+    pthread_cond_t recordEncoded;
+
+    // Started threads, the reader first
+    std::vector<pthread_t> threads;
+
+    // Helper methods with the loops of the reader and encoder threads
+    void readRecords();
+    void encodeRecords();
+
+    // Helper functions to start the thread loops
+    static void* readerMain(void* pipeline);
+    static void* encoderMain(void* pipeline);
+
+    // Helper method to end and join the started threads
+    void stop();
+
+    // Not copyable, the threads refer to it
+    Pipeline(const Pipeline&);
+    Pipeline& operator=(const Pipeline&);
+};
+
+// Constructor: Set up the ring, twice the number of jobs keeps the encoders busy while the writer waits
+BatchEncoder::Pipeline::Pipeline(const BatchEncoder& encoder, FILE* input, unsigned int jobs)
+    : encoder(encoder),
+      input(input),
+      jobs(jobs),
+      slots(2 * jobs),
+      numRead(0),
+      numTaken(0),
+      numWritten(0),
+      endOfInput(false),
+      stopping(false) {
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&slotFreed, NULL);
+    pthread_cond_init(&recordRead, NULL);
+    pthread_cond_init(&recordEncoded, NULL);
+}
+
+// Destructor: Release the locks, the threads have been joined by run
+BatchEncoder::Pipeline::~Pipeline() {
+    pthread_cond_destroy(&recordEncoded);
+    pthread_cond_destroy(&recordRead);
+    pthread_cond_destroy(&slotFreed);
+    pthread_mutex_destroy(&mutex);
+}
+
+// Method to start the threads and write the images in input order
+unsigned long BatchEncoder::Pipeline::run(FILE* output) {
+    unsigned long failed = 0;
+
+    try {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, readerMain, this) != 0) {
+            throw std::runtime_error("Error starting the reader thread.");
+        }
+        threads.push_back(thread);
+        for (unsigned int i = 0; i < jobs; i++) {
+            if (pthread_create(&thread, NULL, encoderMain, this) != 0) {
+                throw std::runtime_error("Error starting the encoder threads.");
+            }
+            threads.push_back(thread);
+        }
+
+        for (;;) {
+            // Wait for the next record in input order, or the end of the input
+            pthread_mutex_lock(&mutex);
+            Slot& slot = slots[numWritten % slots.size()];
+            while (slot.state != ENCODED && !(endOfInput && numWritten == numRead)) {
+                pthread_cond_wait(&recordEncoded, &mutex);
+            }
+            bool done = slot.state != ENCODED;
+            pthread_mutex_unlock(&mutex);
+            if (done) {
+                break;
+            }
+
+            // The slot is not touched by the other threads until it is freed
+            numWritten++;
+            if (slot.failed) {
+                throw std::runtime_error(slot.error);
+            } else if (slot.status == QrCode::SUCCESS) {
+                qrimage::writePbm(slot.qr, output);
+            } else {
+                std::cerr << "Record " << numWritten << ": " << QrCode::getStatusMessage(slot.status, slot.capacity)
+                          << std::endl;
+                failed++;
+            }
+
+            pthread_mutex_lock(&mutex);
+            slot.qr = QrCode();
+            slot.state = EMPTY;
+            pthread_cond_signal(&slotFreed);
+            pthread_mutex_unlock(&mutex);
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+
+    stop();
+    if (!readError.empty()) {
+        throw std::runtime_error(readError);
+    }
+    return failed;
+}
+
+// Helper method with the loop of the reader thread
+void BatchEncoder::Pipeline::readRecords() {
+    std::string record;
+    std::string error;
+
+    for (;;) {
+        // The record is read before waiting for a slot, so that reading overlaps with writing
+        bool any = false;
+        try {
+            any = readRecord(input, record);
+            if (!any && std::ferror(input)) {
+                error = "Error reading the input file.";
+            }
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+
+        pthread_mutex_lock(&mutex);
+        if (!any || !error.empty()) {
+            endOfInput = true;
+            readError = error;
+            pthread_cond_broadcast(&recordRead);
+            pthread_cond_signal(&recordEncoded);
+            pthread_mutex_unlock(&mutex);
+            return;
+        }
+
+        Slot& slot = slots[numRead % slots.size()];
+        while (!stopping && slot.state != EMPTY) {
+            pthread_cond_wait(&slotFreed, &mutex);
+        }
+        if (stopping) {
+            pthread_mutex_unlock(&mutex);
+            return;
+        }
+        slot.record.swap(record);
+        slot.state = READ;
+        numRead++;
+        pthread_cond_signal(&recordRead);
+        pthread_mutex_unlock(&mutex);
+    }
+}
+
+// Helper method with the loop of an encoder thread
+void BatchEncoder::Pipeline::encodeRecords() {
+    pthread_mutex_lock(&mutex);
+    for (;;) {
+        while (!stopping && numTaken == numRead && !endOfInput) {
+            pthread_cond_wait(&recordRead, &mutex);
+        }
+        if (stopping || numTaken == numRead) {
+            break;
+        }
+        Slot& slot = slots[numTaken % slots.size()];
+        numTaken++;
+        slot.state = ENCODING;
+        pthread_mutex_unlock(&mutex);
+
+        // Encode without the lock, the slot belongs to this thread until it is marked as encoded
+        slot.failed = false;
+        try {
+            slot.status = qrtext::tryEncodeText(slot.record.c_str(), encoder.converter, encoder.ecl, slot.qr,
+                                                slot.capacity, encoder.allowEci);
+        } catch (const std::exception& e) {
+            slot.failed = true;
+            slot.error = e.what();
+        }
+
+        pthread_mutex_lock(&mutex);
+        slot.state = ENCODED;
+        pthread_cond_signal(&recordEncoded);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+// Helper function to start the loop of the reader thread
+void* BatchEncoder::Pipeline::readerMain(void* pipeline) {
+    static_cast<Pipeline*>(pipeline)->readRecords();
+    return NULL;
+}
+
+// Helper function to start the loop of an encoder thread
+void* BatchEncoder::Pipeline::encoderMain(void* pipeline) {
+    static_cast<Pipeline*>(pipeline)->encodeRecords();
+    return NULL;
+}
+
+// Helper method to end and join the started threads
+void BatchEncoder::Pipeline::stop() {
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_broadcast(&slotFreed);
+    pthread_cond_broadcast(&recordRead);
+    pthread_mutex_unlock(&mutex);
+
+    for (size_t i = 0; i < threads.size(); i++) {
+        pthread_join(threads[i], NULL);
+    }
+    threads.clear();
+}
+#endif
+
+// Constructor: Set the converter, error correction level, ECI option and number of encoder threads
+BatchEncoder::BatchEncoder(const charconv::CharConverter& converter, QrCode::Ecc ecl, bool allowEci,
+                           unsigned int jobs)
+    : converter(converter), ecl(ecl), allowEci(allowEci), jobs(jobs) {
+}
+
+// Method to encode all records of the input file into the output file
+unsigned long BatchEncoder::run(FILE* input, FILE* output) const {
+#if defined(QRBATCH_THREADS)
+    if (jobs > 1) {
+        Pipeline pipeline(*this, input, jobs);
+        return pipeline.run(output);
+    }
+#endif
+
+    unsigned long recordNumber = 0;
+    unsigned long failed = 0;
+    std::string record;
+
+    while (readRecord(input, record)) {
+        recordNumber++;
+
+        // Records that do not fit are reported without an exception, they can be frequent
+        QrCode qr;
+        QrCode::Capacity capacity;
+        QrCode::Status status = qrtext::tryEncodeText(record.c_str(), converter, ecl, qr, capacity, allowEci);
+        if (status == QrCode::SUCCESS) {
+            qrimage::writePbm(qr, output);
+        } else {
+            std::cerr << "Record " << recordNumber << ": " << QrCode::getStatusMessage(status, capacity) << std::endl;
+            failed++;
+        }
+    }
+
+    if (ferror(input)) {
+        throw std::runtime_error("Error reading the input file.");
+    }
+    return failed;
+}
+
+// Helper method to read the next line without its line break
+bool BatchEncoder::readRecord(FILE* input, std::string& record) {
+    char chunk[256];
+    bool any = false;
+
+    record.clear();
+    while (std::fgets(chunk, sizeof(chunk), input)) {
+        any = true;
+        record += chunk;
+        if (record[record.size() - 1] == '\n') {
+            break;
+        }
+    }
+
+    // Strip the line break, DOS files end lines with CR LF
+    while (!record.empty() && (record[record.size() - 1] == '\n' || record[record.size() - 1] == '\r')) {
+        record.erase(record.size() - 1);
+    }
+    return any;
+}
+}  // namespace qrbatch
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRBATCH_HPP
+#define QRBATCH_HPP
+
+#include <cstdio>
+#include <string>
+
+#include "charconv.hpp"
+#include "qrcodegen.hpp"
+
+// Hosts with POSIX threads can run the batch as a pipeline of threads, see BatchEncoder
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__unix__)
+#define QRBATCH_THREADS
+#endif
+
+namespace qrbatch {
+
+/*
+ * This class encodes a file of records, one text per line in the codepage of the given converter,
+ * to QR codes and writes them as one stream of images in input order. Records are read, encoded
+ * and written one at a time, so memory use does not grow with the size of the input.
+ *
+ * With more than one job on hosts with POSIX threads the stages overlap: a reader thread, a pool of
+ * that many encoder threads and the calling thread as writer share a bounded ring of records. A full
+ * ring holds back the reader and the writer takes the records in input order, so memory use is still
+ * bounded and the output is the same. Elsewhere, e.g. on DOS, the number of jobs is ignored.
+ */
+class BatchEncoder {
+   public:
+    // Constructor to set the converter for the input codepage and the error correction level,
+    // whether records may use the ECI encoding (see qrtext::encodeText) and the number of encoder threads
+    BatchEncoder(const charconv::CharConverter& converter, qrcodegen::QrCode::Ecc ecl, bool allowEci = false,
+                 unsigned int jobs = 1);
+
+    // Method to encode all records of the input file into the output file. Records that can not
+    // be encoded are reported on stderr and skipped. Returns the number of failed records.
+    unsigned long run(FILE* input, FILE* output) const;
+
+   private:
+    // Converter for the codepage of the records
+    const charconv::CharConverter& converter;
+
+    // Error correction level for all QR codes
+    qrcodegen::QrCode::Ecc ecl;
+
+    // Whether records may use the ECI encoding
+    bool allowEci;
+
+    // Number of encoder threads, 1 to encode on the calling thread
+    unsigned int jobs;
+
+    // Stages of the run with threads, only defined where they are available
+    class Pipeline;
+
+    // Helper method to read the next line without its line break, returns false at the end of the input
+    static bool readRecord(FILE* input, std::string& record);
+};
+}  // namespace qrbatch
+
+#endif  // QRBATCH_HPP
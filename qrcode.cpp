@@ -23,27 +23,82 @@
 
 #include <conio.h>
 #include <dos.h>
+#include <fcntl.h>
+#include <io.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <vector>
 
 #include "charconv.hpp"
+#include "qrbatch.hpp"
 #include "qrcodegen.hpp"
+#include "qrserv.hpp"
+#include "qrtext.hpp"
+#include "textmode.hpp"
 
 #define QR_CODE_VERSION "1.0.3"
 
+// Largest number of encoder threads for the batch mode
+#define MAX_JOBS 64
+
 using charconv::CharConverter;
+using qrbatch::BatchEncoder;
 using qrcodegen::QrCode;
 using qrcodegen::QrSegment;
+using qrserv::EncodeService;
+using textmode::TextRenderer;
 
 // Function prototypes
 static void printQrCGA(const QrCode& qr);
+static bool printQrText(const QrCode& qr);
 static void setPixel(int x, int y, int color);
 static void setVideoMode(unsigned char mode);
 static uint8_t getVideoMode();
+static uint16_t getCursorShape();
+static void setCursorShape(uint16_t shape);
 static void printUsage();
+static int runBatch(const char* inputName, const char* outputName, bool allowEci, unsigned int jobs);
+static int runService();
+static bool isOption(const char* arg, char option);
 static uint16_t getSystemCodepage();
 
 int main(int argc, char* argv[]) {
+    // Leading option to allow the shorter ECI encoding of non ASCII text
+    bool allowEci = false;
+    if (argc > 1 && isOption(argv[1], 'E')) {
+        allowEci = true;
+        argc--;
+        argv++;
+    }
+
+    // Leading option to set the number of encoder threads of the batch mode
+    unsigned int jobs = 1;
+    if (argc > 2 && isOption(argv[1], 'J')) {
+        char* end;
+        unsigned long value = std::strtoul(argv[2], &end, 10);
+        if (*end != '\0' || value < 1 || value > MAX_JOBS) {
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        jobs = static_cast<unsigned int>(value);
+        argc -= 2;
+        argv += 2;
+    }
+
+    // Batch mode: encode every line of a file
+    if (argc == 4 && isOption(argv[1], 'B')) {
+        return runBatch(argv[2], argv[3], allowEci, jobs);
+    }
+
+    // Service mode: serve encode requests on stdin/stdout
+    if (argc == 2 && isOption(argv[1], 'S')) {
+        return runService();
+    }
+
     // Check if the required parameters are provided
     if (argc != 2) {
         printUsage();
@@ -53,24 +108,77 @@ int main(int argc, char* argv[]) {
     const char* text = argv[1];
 
     try {
-        // Convert the text to UTF-8 using the system codepage
-        char utf8Text[2048];
+        // Generate the QR Code, the text is converted to UTF-8 using the system codepage
         const CharConverter converter(getSystemCodepage());
-        converter.convert(text, utf8Text, 2048);
+        const QrCode qr = qrtext::encodeText(text, converter, QrCode::LOW, allowEci);
+
+        // Prefer the current text screen, it needs no mode switch
+        if (!printQrText(qr)) {
+            // remember current mode and set CGA 320x200 4 color mode
+            uint8_t initialVideoMode = getVideoMode();
+            setVideoMode(0x04);
+
+            printQrCGA(qr);
 
-        // Generate the QR Code
-        const QrCode qr = QrCode::encodeText(utf8Text, QrCode::LOW);
+            // Wait for a key press and restore previous mode
+            getch();
+            setVideoMode(initialVideoMode);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
 
-        // remember current mode and set CGA 320x200 4 color mode
-        uint8_t initialVideoMode = getVideoMode();
-        setVideoMode(0x04);
+    return EXIT_SUCCESS;
+}
 
-        printQrCGA(qr);
+// Function to encode every line of the input file, the QR codes are written to the output file
+// as PBM images in input order
+static int runBatch(const char* inputName, const char* outputName, bool allowEci, unsigned int jobs) {
+    FILE* input = std::fopen(inputName, "rb");
+    if (!input) {
+        std::cerr << "Error: Can not open " << inputName << std::endl;
+        return EXIT_FAILURE;
+    }
 
-        // Wait for a key press and restore previous mode
-        getch();
-        setVideoMode(initialVideoMode);
+    FILE* output = std::fopen(outputName, "wb");
+    if (!output) {
+        std::fclose(input);
+        std::cerr << "Error: Can not create " << outputName << std::endl;
+        return EXIT_FAILURE;
+    }
 
+    unsigned long failed = 0;
+    bool ok = true;
+    try {
+        const CharConverter converter(getSystemCodepage());
+        const BatchEncoder encoder(converter, QrCode::LOW, allowEci, jobs);
+        failed = encoder.run(input, output);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        ok = false;
+    }
+
+    std::fclose(input);
+    if (std::fclose(output) != 0) {
+        std::cerr << "Error: Can not write " << outputName << std::endl;
+        ok = false;
+    }
+
+    return (ok && failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Function to serve encode requests on stdin/stdout until QUIT or the end of the input
+static int runService() {
+    // Requests and replies carry binary data
+    setmode(fileno(stdin), O_BINARY);
+    setmode(fileno(stdout), O_BINARY);
+
+    try {
+        const CharConverter converter(getSystemCodepage());
+        EncodeService service(converter);
+        service.run(stdin, stdout);
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return EXIT_FAILURE;
@@ -79,16 +187,31 @@ int main(int argc, char* argv[]) {
     return EXIT_SUCCESS;
 }
 
+// Function to check for a command line option like /B or -b
+static bool isOption(const char* arg, char option) {
+    return (arg[0] == '/' || arg[0] == '-') && std::toupper(static_cast<unsigned char>(arg[1])) == option &&
+           arg[2] == '\0';
+}
+
 // Function to print usage information
 static void printUsage() {
     std::cout << "QRCode Generator " << QR_CODE_VERSION << " for MS-DOS CGA systems. (c) 2025 Christian Charon" << std::endl
               << "Contact: ccharon@mailbox.org | Licensed under the MIT License." << std::endl
               << "Sources: https://github.com/ccharon/qrcode" << std::endl
               << std::endl
-              << "Usage: qrcode.exe \"<text>\"" << std::endl
+              << "Usage: qrcode.exe [/E] \"<text>\"" << std::endl
+              << "       qrcode.exe [/E] [/J <jobs>] /B <infile> <outfile>" << std::endl
+              << "       qrcode.exe /S" << std::endl
               << std::endl
               << "Options:" << std::endl
               << "  <text>       The message to encode in the QR Code." << std::endl
+              << "  /B           Batch mode, encodes every line of <infile> and writes the" << std::endl
+              << "               QR Codes to <outfile> as PBM images, in the same order." << std::endl
+              << "  /J <jobs>    Number of encoder threads in batch mode, 1 to " << MAX_JOBS << "." << std::endl
+              << "               Used on hosts with threads, DOS encodes one at a time." << std::endl
+              << "  /S           Service mode, answers encode requests on stdin/stdout." << std::endl
+              << "  /E           Store text in a single byte charset with an ECI marker" << std::endl
+              << "               instead of UTF-8 if that gives a smaller QR Code." << std::endl
               << std::endl
               << "Examples:" << std::endl
               << "  qrcode.exe \"Hello, world!\"" << std::endl
@@ -96,10 +219,12 @@ static void printUsage() {
               << std::endl
               << "The text for the QR Code is encoded to UTF-8. Automatic conversion from" << std::endl
               << "codepages 437, 850, 852, 858, 866, and 737 is supported, 437 is the fallback." << std::endl
+              << std::endl
+              << "The QR Code is shown on the text screen if it fits, else in CGA 320x200 mode." << std::endl
               << std::endl;
 }
 
-/*---- CGA Mode Helper ----*/
+/*---- Video BIOS Helper ----*/
 
 // BIOS Interrupt call to set the video mode
 static void setVideoMode(uint8_t mode) {
@@ -117,6 +242,64 @@ static uint8_t getVideoMode() {
     return regs.h.al;
 }
 
+// BIOS Interrupt call to get the current cursor shape (start and end scan line)
+static uint16_t getCursorShape() {
+    union REGS regs;
+    regs.h.ah = 0x03;
+    regs.h.bh = 0x00;
+    int86(0x10, &regs, &regs);
+    return regs.x.cx;
+}
+
+// BIOS Interrupt call to set the cursor shape, 0x2000 hides the cursor
+static void setCursorShape(uint16_t shape) {
+    union REGS regs;
+    regs.h.ah = 0x01;
+    regs.x.cx = shape;
+    int86(0x10, &regs, &regs);
+}
+
+/*---- Text Mode Helper ----*/
+
+// Render a centered QR code on the current 80 column color text screen, waits for a key press
+// and restores the screen afterwards. Returns false if the screen is not usable for the QR code.
+static bool printQrText(const QrCode& qr) {
+    uint8_t mode = getVideoMode();
+    if (mode != 0x02 && mode != 0x03) {
+        return false;  // Only the color text modes use VRAM at B800
+    }
+
+    // Screen size and page offset from the BIOS data area, rows are only maintained by EGA and later
+    uint16_t columns = *(uint16_t far*)0x0040004AL;
+    uint8_t lastRow = *(uint8_t far*)0x00400084L;
+    uint16_t pageOffset = *(uint16_t far*)0x0040004EL;
+    uint16_t rows = (lastRow == 0) ? 25 : lastRow + 1;
+
+    const TextRenderer renderer(columns, rows);
+    if (!renderer.fits(qr)) {
+        return false;
+    }
+
+    uint16_t far* screen = (uint16_t far*)(0xB8000000L + pageOffset);
+    const size_t cells = static_cast<size_t>(columns) * rows;
+
+    // Keep a copy of the screen contents and the cursor
+    std::vector<uint16_t> saved(screen, screen + cells);
+    uint16_t cursorShape = getCursorShape();
+    setCursorShape(0x2000);
+
+    renderer.render(qr, screen);
+
+    // Wait for a key press and restore the previous screen
+    getch();
+    std::copy(saved.begin(), saved.end(), screen);
+    setCursorShape(cursorShape);
+
+    return true;
+}
+
+/*---- CGA Mode Helper ----*/
+
 // Render a centered QR code in CGA 320x200 mode
 static void printQrCGA(const QrCode& qr) {
     const int border = 4;  // Border size in QR modules
@@ -137,10 +320,13 @@ static void printQrCGA(const QrCode& qr) {
     int startX = (320 - pixelWidth) / 2;   // Horizontal centering
     int startY = (200 - pixelHeight) / 2;  // Vertical centering
 
-    // Render the QR code
+    // Render the QR code, one packed row of modules at a time
+    std::vector<uint8_t> packedRow(qr.getPackedLineBytes(border));
     for (int y = -border; y < qr.getSize() + border; y++) {          // rows
+        qr.getRowBits(-border, y, qrSize, &packedRow[0]);
         for (int x = -border; x < qr.getSize() + border; x++) {      // columns
-            int color = qr.getModule(x, y) ? 0 : 1;                  // Black or white module
+            const int i = x + border;                                // Index in the packed row
+            int color = (packedRow[i >> 3] & (0x80 >> (i & 7))) ? 0 : 1;  // Black or white module
             for (int dy = 0; dy < scaleY; dy++) {                    // vertical scaling
                 for (int dx = 0; dx < scaleX; dx++) {                // horizontal scaling
                     int xPos = startX + (x + border) * scaleX + dx;  // Horizontal position
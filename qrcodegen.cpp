@@ -29,10 +29,15 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 #include <sstream>
 #include <utility>
 #include "qrcodegen.hpp"
 
+#if defined(QRCODEGEN_X86_DISPATCH)
+#include <immintrin.h>
+#endif
+
 using std::int8_t;
 using std::uint8_t;
 using std::size_t;
@@ -75,79 +80,82 @@ QrSegment QrSegment::makeBytes(const vector<uint8_t> &data) {
 	for (size_t i = 0; i < data.size(); i++)
 		bb.appendBits(data[i], 8);
 	
-	QrSegment segment(Mode::BYTE, static_cast<int>(data.size()), bb);
-	bb.swap(segment.data);
-
-	return segment;
+	return QrSegment(Mode::BYTE, static_cast<int>(data.size()), bb);
 }
 
 
 QrSegment QrSegment::makeNumeric(const char *digits) {
 	BitBuffer bb;
-	int accumData = 0;
-	int accumCount = 0;
-	int charCount = 0;
-	for (; *digits != '\0'; digits++, charCount++) {
-		char c = *digits;
-		if (c < '0' || c > '9')
-			throw std::domain_error("String contains non-numeric characters");
-		accumData = accumData * 10 + (c - '0');
-		accumCount++;
-		if (accumCount == 3) {
-			bb.appendBits(static_cast<uint32_t>(accumData), 10);
-			accumData = 0;
-			accumCount = 0;
-		}
-	}
-	if (accumCount > 0)  // 1 or 2 digits remaining
-		bb.appendBits(static_cast<uint32_t>(accumData), accumCount * 3 + 1);
-
-	QrSegment segment(Mode::NUMERIC, charCount, bb);
-	bb.swap(segment.data);
-	return segment;
+	const char *end = appendNumeric(digits, bb);
+	if (*end != '\0')
+		throw std::domain_error("String contains non-numeric characters");
+	
+	return QrSegment(Mode::NUMERIC, static_cast<int>(end - digits), bb);
 }
 
 
 QrSegment QrSegment::makeAlphanumeric(const char *text) {
 	BitBuffer bb;
-	int accumData = 0;
-	int accumCount = 0;
-	int charCount = 0;
-	for (; *text != '\0'; text++, charCount++) {
-		const char *temp = std::strchr(ALPHANUMERIC_CHARSET, *text);
-		if (temp == NULL)
-			throw std::domain_error("String contains unencodable characters in alphanumeric mode");
-		accumData = accumData * 45 + static_cast<int>(temp - ALPHANUMERIC_CHARSET);
-		accumCount++;
-		if (accumCount == 2) {
-			bb.appendBits(static_cast<uint32_t>(accumData), 11);
-			accumData = 0;
-			accumCount = 0;
-		}
-	}
-	if (accumCount > 0)  // 1 character remaining
-		bb.appendBits(static_cast<uint32_t>(accumData), 6);
-
-	QrSegment segment(Mode::ALPHANUMERIC, charCount, bb);
-	bb.swap(segment.data);
-	return segment;
+	const char *end = appendAlphanumeric(text, bb);
+	if (*end != '\0')
+		throw std::domain_error("String contains unencodable characters in alphanumeric mode");
+	
+	return QrSegment(Mode::ALPHANUMERIC, static_cast<int>(end - text), bb);
 }
 
 
 vector<QrSegment> QrSegment::makeSegments(const char *text) {
-	// Select the most efficient segment encoding automatically
+	// Select the most efficient segment encoding automatically. The text is encoded in the narrowest
+	// mode right away; at the first character that doesn't fit, encoding restarts in a wider mode.
 	vector<QrSegment> result;
-	if (*text == '\0');  // Leave result empty
-	else if (isNumeric(text))
-		result.push_back(makeNumeric(text));
-	else if (isAlphanumeric(text))
-		result.push_back(makeAlphanumeric(text));
-	else {
-		vector<uint8_t> bytes;
-		for (; *text != '\0'; text++)
-			bytes.push_back(static_cast<uint8_t>(*text));
-		result.push_back(makeBytes(bytes));
+	if (*text == '\0')
+		return result;  // Leave result empty
+	
+	const Mode *md = &Mode::NUMERIC;
+	BitBuffer bb;
+	const char *end = appendNumeric(text, bb);
+	if (*end != '\0' && (CHAR_CLASSES[static_cast<uint8_t>(*end)] & CLASS_ALPHANUMERIC) != 0) {
+		md = &Mode::ALPHANUMERIC;
+		bb.clear();
+		end = appendAlphanumeric(text, bb);
+	}
+	if (*end != '\0') {
+		md = &Mode::BYTE;
+		bb.clear();
+		for (end = text; *end != '\0'; end++)
+			bb.appendBits(static_cast<uint8_t>(*end), 8);
 	}
+	
+	// Hand the bits over without copying them
+	QrSegment segment(*md, static_cast<int>(end - text), bb);
+	result.push_back(QrSegment());
+	result.back().swap(segment);
+	return result;
+}
+
+
+vector<QrSegment> QrSegment::makeSegments(const char *text, const Mode *md) {
+	vector<QrSegment> result;
+	if (md == NULL)
+		return result;  // Leave result empty
+	
+	BitBuffer bb;
+	const char *end;
+	if (md == &Mode::NUMERIC)
+		end = appendNumeric(text, bb);
+	else if (md == &Mode::ALPHANUMERIC)
+		end = appendAlphanumeric(text, bb);
+	else if (md == &Mode::BYTE) {
+		for (end = text; *end != '\0'; end++)
+			bb.appendBits(static_cast<uint8_t>(*end), 8);
+	} else
+		throw std::domain_error("Mode not supported");
+	if (*end != '\0')
+		throw std::domain_error("String contains unencodable characters in the given mode");
+	
+	QrSegment segment(*md, static_cast<int>(end - text), bb);
+	result.push_back(QrSegment());
+	result.back().swap(segment);
 	return result;
 }
 
@@ -167,9 +175,7 @@ QrSegment QrSegment::makeEci(long assignVal) {
 	} else
 		throw std::domain_error("ECI assignment value out of range");
 
-	QrSegment segment(Mode::ECI, 0, bb);
-	bb.swap(segment.data);
-	return segment;
+	return QrSegment(Mode::ECI, 0, bb);
 }
 
 
@@ -191,10 +197,10 @@ QrSegment::QrSegment(const Mode &md, int numCh, const std::vector<bool> &dt) :
 
 QrSegment::QrSegment(const Mode &md, int numCh, std::vector<bool> &dt) :
 		mode(&md),
-		numChars(numCh),
-		data(dt) {
+		numChars(numCh) {
 	if (numCh < 0)
 		throw std::domain_error("Invalid value");
+	data.swap(dt);
 }
 
 
@@ -218,8 +224,7 @@ static int QrSegment::getTotalBits(const vector<QrSegment> &segs, int version) {
 
 bool QrSegment::isNumeric(const char *text) {
 	for (; *text != '\0'; text++) {
-		char c = *text;
-		if (c < '0' || c > '9')
+		if ((CHAR_CLASSES[static_cast<uint8_t>(*text)] & CLASS_NUMERIC) == 0)
 			return false;
 	}
 	return true;
@@ -228,13 +233,92 @@ bool QrSegment::isNumeric(const char *text) {
 
 bool QrSegment::isAlphanumeric(const char *text) {
 	for (; *text != '\0'; text++) {
-		if (std::strchr(ALPHANUMERIC_CHARSET, *text) == NULL)
+		if ((CHAR_CLASSES[static_cast<uint8_t>(*text)] & CLASS_ALPHANUMERIC) == 0)
 			return false;
 	}
 	return true;
 }
 
 
+const char *QrSegment::appendNumeric(const char *text, BitBuffer &bb) {
+	int accumData = 0;
+	int accumCount = 0;
+	for (; (CHAR_CLASSES[static_cast<uint8_t>(*text)] & CLASS_NUMERIC) != 0; text++) {
+		accumData = accumData * 10 + (*text - '0');
+		accumCount++;
+		if (accumCount == 3) {
+			bb.appendBits(static_cast<uint32_t>(accumData), 10);
+			accumData = 0;
+			accumCount = 0;
+		}
+	}
+	if (accumCount > 0)  // 1 or 2 digits remaining
+		bb.appendBits(static_cast<uint32_t>(accumData), accumCount * 3 + 1);
+	return text;
+}
+
+
+const char *QrSegment::appendAlphanumeric(const char *text, BitBuffer &bb) {
+	int accumData = 0;
+	int accumCount = 0;
+	for (; ; text++) {
+		uint8_t cls = CHAR_CLASSES[static_cast<uint8_t>(*text)];
+		if ((cls & CLASS_ALPHANUMERIC) == 0)
+			break;
+		accumData = accumData * 45 + (cls & CLASS_VALUE_MASK);
+		accumCount++;
+		if (accumCount == 2) {
+			bb.appendBits(static_cast<uint32_t>(accumData), 11);
+			accumData = 0;
+			accumCount = 0;
+		}
+	}
+	if (accumCount > 0)  // 1 character remaining
+		bb.appendBits(static_cast<uint32_t>(accumData), 6);
+	return text;
+}
+
+
+const QrSegment::Mode *QrSegment::classifyText(const char *text, long &numChars, bool &ascii) {
+	uint8_t common = CLASS_NUMERIC | CLASS_ALPHANUMERIC;
+	uint8_t any = 0;
+	numChars = 0;
+	for (; *text != '\0'; text++, numChars++) {
+		common &= CHAR_CLASSES[static_cast<uint8_t>(*text)];
+		any |= static_cast<uint8_t>(*text);
+	}
+	ascii = (any & 0x80) == 0;
+	
+	if (numChars == 0)
+		return NULL;
+	else if ((common & CLASS_NUMERIC) != 0)
+		return &Mode::NUMERIC;
+	else if ((common & CLASS_ALPHANUMERIC) != 0)
+		return &Mode::ALPHANUMERIC;
+	else
+		return &Mode::BYTE;
+}
+
+
+long QrSegment::getDataBits(const Mode &md, long numChars) {
+	if (&md == &Mode::NUMERIC)
+		return numChars / 3 * 10 + (numChars % 3 == 0 ? 0 : numChars % 3 * 3 + 1);
+	else if (&md == &Mode::ALPHANUMERIC)
+		return numChars / 2 * 11 + (numChars % 2) * 6;
+	else if (&md == &Mode::BYTE)
+		return numChars * 8;
+	else
+		throw std::domain_error("Mode not supported");
+}
+
+
+void QrSegment::swap(QrSegment &other) {
+	std::swap(mode, other.mode);
+	std::swap(numChars, other.numChars);
+	data.swap(other.data);
+}
+
+
 const QrSegment::Mode &QrSegment::getMode() const {
 	return *mode;
 }
@@ -250,7 +334,24 @@ const std::vector<bool> &QrSegment::getData() const {
 }
 
 
-const char *QrSegment::ALPHANUMERIC_CHARSET = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+const uint8_t QrSegment::CHAR_CLASSES[256] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10
+	0x64, 0x00, 0x00, 0x00, 0x65, 0x66, 0x00, 0x00, 0x00, 0x00, 0x67, 0x68, 0x00, 0x69, 0x6A, 0x6B,  // 0x20
+	0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x30
+	0x00, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,  // 0x40
+	0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE0
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF0
+};
 
 
 
@@ -267,13 +368,39 @@ int QrCode::getFormatBits(Ecc ecl) {
 }
 
 
+int QrCode::getFormatWord(Ecc ecl, int msk) {
+	int data = getFormatBits(ecl) << 3 | msk;  // errCorrLvl is uint2, msk is uint3
+	int rem = data;
+	for (int i = 0; i < 10; i++)
+		rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+	int bits = (data << 10 | rem) ^ 0x5412;  // uint15
+	assert(bits >> 15 == 0);
+	return bits;
+}
+
+
+long QrCode::getVersionWord(int ver) {
+	int rem = ver;  // version is uint6, in the range [7, 40]
+	for (int i = 0; i < 12; i++)
+		rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+	long bits = static_cast<long>(ver) << 12 | rem;  // uint18
+	assert(bits >> 18 == 0);
+	return bits;
+}
+
+
 QrCode QrCode::encodeText(const char *text, Ecc ecl) {
-	vector<QrSegment> segs = QrSegment::makeSegments(text);
-	return encodeSegments(segs, ecl);
+	QrCode result;
+	Capacity capacity;
+	Status status = tryEncodeText(text, ecl, result, capacity);
+	if (status != SUCCESS)
+		throwStatus(status, capacity);
+	return result;
 }
 
 
 QrCode QrCode::encodeBinary(const vector<uint8_t> &data, Ecc ecl) {
+	AllocationTracker::StageGuard stage(AllocationTracker::SEGMENTS);
 	vector<QrSegment> segs;
 	segs.push_back(QrSegment::makeBytes(data));
 	return encodeSegments(segs, ecl);
@@ -282,36 +409,100 @@ QrCode QrCode::encodeBinary(const vector<uint8_t> &data, Ecc ecl) {
 
 QrCode QrCode::encodeSegments(const vector<QrSegment> &segs, Ecc ecl,
         int minVersion, int maxVersion, int mask, bool boostEcl) {
-	if (!(MIN_VERSION <= minVersion && minVersion <= maxVersion && maxVersion <= MAX_VERSION) || mask < -1 || mask > 7)
-        throw std::invalid_argument("Invalid value");
-
-    // Find the minimal version number to use
-    int version, dataUsedBits;
-    for (version = minVersion; ; version++) {
-        int dataCapacityBits = getNumDataCodewords(version, ecl) * 8;  // Number of data bits available
-        dataUsedBits = QrSegment::getTotalBits(segs, version);
-        if (dataUsedBits != -1 && dataUsedBits <= dataCapacityBits)
-            break;  // This version number is found to be suitable
-        if (version >= maxVersion) {  // All versions in the range could not fit the given data
-            char buffer[64];
-            if (dataUsedBits == -1) {
-                std::strcpy(buffer, "Segment too long");
-            } else {
-                std::sprintf(buffer, "Data length = %d bits, Max capacity = %d bits", dataUsedBits, dataCapacityBits);
-            }
-            throw data_too_long(std::string(buffer));
-        }
-    }
-    assert(dataUsedBits != -1);
+	QrCode result;
+	Capacity capacity;
+	Status status = tryEncodeSegments(segs, ecl, result, capacity, minVersion, maxVersion, mask, boostEcl);
+	if (status != SUCCESS)
+		throwStatus(status, capacity);
+	return result;
+}
+
+
+QrCode::Status QrCode::tryEncodeText(const char *text, Ecc ecl, QrCode &result, Capacity &capacity) {
+	AllocationTracker::StageGuard stage(AllocationTracker::SEGMENTS);
+	
+	// Check the capacity before building any segment
+	long numChars;
+	bool ascii;
+	const QrSegment::Mode *md = QrSegment::classifyText(text, numChars, ascii);
+	capacity = planSegment(md, numChars, ecl);
+	if (capacity.version == -1)
+		return capacity.usedBits == -1 ? SEGMENT_TOO_LONG : DATA_TOO_LONG;
+	
+	vector<QrSegment> segs = QrSegment::makeSegments(text, md);
+	return tryEncodeSegments(segs, ecl, result, capacity);
+}
+
+
+QrCode::Status QrCode::tryEncodeSegments(const vector<QrSegment> &segs, Ecc ecl, QrCode &result,
+		Capacity &capacity, int minVersion, int maxVersion, int mask, bool boostEcl) {
+	AllocationTracker::StageGuard stage(AllocationTracker::CODEWORDS);
+	if (!(MIN_VERSION <= minVersion && minVersion <= maxVersion && maxVersion <= MAX_VERSION) || mask < -1 || mask > 7) {
+		capacity.version = capacity.size = capacity.usedBits = capacity.capacityBits = -1;
+		return INVALID_ARGUMENT;
+	}
+	
+	// Find the minimal version number to use
+	capacity = planSegments(segs, ecl, minVersion, maxVersion);
+	if (capacity.version == -1)  // All versions in the range could not fit the given data
+		return capacity.usedBits == -1 ? SEGMENT_TOO_LONG : DATA_TOO_LONG;
+	
+	result = encodeVersion(segs, ecl, capacity.version, capacity.usedBits, mask, boostEcl);
+	return SUCCESS;
+}
+
+
+std::string QrCode::getStatusMessage(Status status, const Capacity &capacity) {
+	switch (status) {
+		case SUCCESS:
+			return std::string();
+		case DATA_TOO_LONG: {
+			char buffer[64];
+			std::sprintf(buffer, "Data length = %d bits, Max capacity = %d bits", capacity.usedBits, capacity.capacityBits);
+			return std::string(buffer);
+		}
+		case SEGMENT_TOO_LONG:
+			return std::string("Segment too long");
+		case INVALID_ARGUMENT:
+			return std::string("Invalid value");
+		default:
+			throw std::logic_error("Unreachable");
+	}
+}
+
 
+void QrCode::throwStatus(Status status, const Capacity &capacity) {
+	if (status == INVALID_ARGUMENT)
+		throw std::invalid_argument(getStatusMessage(status, capacity));
+	throw data_too_long(getStatusMessage(status, capacity));
+}
+
+
+QrCode QrCode::encodeVersion(const vector<QrSegment> &segs, Ecc ecl, int version,
+		int dataUsedBits, int mask, bool boostEcl) {
+	assert(dataUsedBits != -1);
+	if (boostEcl)
+		ecl = getBoostedEcl(version, ecl, dataUsedBits);
+	const vector<uint8_t> dataCodewords = makeDataCodewords(segs, version, ecl, dataUsedBits);
+	
+	// Create the QR Code object
+	return QrCode(version, ecl, dataCodewords, mask);
+}
+
+
+QrCode::Ecc QrCode::getBoostedEcl(int version, Ecc ecl, int dataUsedBits) {
     // Increase the error correction level while the data still fits in the current version number
     Ecc errorLevels[] = {MEDIUM, QUARTILE, HIGH}; // From low to high
     for (int i = 0; i < 3; i++) { 
         Ecc newEcl = errorLevels[i];
-        if (boostEcl && dataUsedBits <= getNumDataCodewords(version, newEcl) * 8)
+        if (dataUsedBits <= getNumDataCodewords(version, newEcl) * 8)
             ecl = newEcl;
     }
+    return ecl;
+}
 
+
+vector<uint8_t> QrCode::makeDataCodewords(const vector<QrSegment> &segs, int version, Ecc ecl, int dataUsedBits) {
     // Concatenate all segments to create the data bit string
     BitBuffer bb;
 	for (size_t i = 0; i < segs.size(); i++) {
@@ -339,31 +530,107 @@ QrCode QrCode::encodeSegments(const vector<QrSegment> &segs, Ecc ecl,
     vector<uint8_t> dataCodewords(bb.size() / 8);
     for (size_t i = 0; i < bb.size(); i++)
         dataCodewords.at(i >> 3) |= (bb.at(i) ? 1 : 0) << (7 - (i & 7));
+    return dataCodewords;
+}
+
+
+QrCode::Capacity QrCode::planSegments(const vector<QrSegment> &segs, Ecc ecl, int minVersion, int maxVersion) {
+	if (!(MIN_VERSION <= minVersion && minVersion <= maxVersion && maxVersion <= MAX_VERSION))
+		throw std::invalid_argument("Invalid value");
+	
+	// The first version of each range of character count field widths
+	int usedBits[3];
+	usedBits[0] = QrSegment::getTotalBits(segs,  1);
+	usedBits[1] = QrSegment::getTotalBits(segs, 10);
+	usedBits[2] = QrSegment::getTotalBits(segs, 27);
+	return findVersion(usedBits, ecl, minVersion, maxVersion);
+}
+
+
+QrCode::Capacity QrCode::planSegment(const QrSegment::Mode *md, long numChars, Ecc ecl, int minVersion, int maxVersion) {
+	if (!(MIN_VERSION <= minVersion && minVersion <= maxVersion && maxVersion <= MAX_VERSION))
+		throw std::invalid_argument("Invalid value");
+	int usedBits[3];
+	getTextBits(md, numChars, usedBits);
+	return findVersion(usedBits, ecl, minVersion, maxVersion);
+}
+
+
+void QrCode::planText(const char *text, Capacity plans[4]) {
+	long numChars;
+	bool ascii;
+	const QrSegment::Mode *md = QrSegment::classifyText(text, numChars, ascii);
+	int usedBits[3];
+	getTextBits(md, numChars, usedBits);
+	for (int i = 0; i < 4; i++)
+		plans[i] = findVersion(usedBits, static_cast<Ecc>(i), MIN_VERSION, MAX_VERSION);
+}
 
-    // Create the QR Code object
-    return QrCode(version, ecl, dataCodewords, mask);
+
+void QrCode::getTextBits(const QrSegment::Mode *md, long numChars, int usedBits[3]) {
+	// Same as QrSegment::getTotalBits() for the single segment built by makeSegments()
+	const int firstVersions[3] = {1, 10, 27};
+	for (int i = 0; i < 3; i++) {
+		if (md == NULL) {
+			usedBits[i] = 0;
+			continue;
+		}
+		int ccbits = md->numCharCountBits(firstVersions[i]);
+		long bits = 4 + ccbits + QrSegment::getDataBits(*md, numChars);
+		if (numChars >= (1L << ccbits) || bits > INT_MAX)
+			usedBits[i] = -1;
+		else
+			usedBits[i] = static_cast<int>(bits);
+	}
 }
 
 
 QrCode::QrCode(int ver, Ecc ecl, const vector<uint8_t> &dataCodewords, int msk) :
 		// Initialize fields and check arguments
 		version(ver),
-		errorCorrectionLevel(ecl) {
+		errorCorrectionLevel(ecl),
+		shared(NULL) {
 	if (ver < MIN_VERSION || ver > MAX_VERSION)
 		throw std::domain_error("Version value out of range");	
 	if (msk < -1 || msk > 7)
 		throw std::domain_error("Mask value out of range");
 	size = ver * 4 + 17;
+	
+	// Compute ECC, draw modules and do masking
+	AllocationTracker::StageGuard stage(AllocationTracker::ECC);
+	const vector<uint8_t> allCodewords = addEccAndInterleave(dataCodewords);
+	AllocationTracker::enterStage(AllocationTracker::MODULES);
+	mask = drawModules(allCodewords, msk);
+	assert(0 <= mask && mask <= 7);
+}
+
+
+int QrCode::drawModules(const vector<uint8_t> &allCodewords, int msk) {
 	size_t sz = static_cast<size_t>(size);
 	modules    = vector<vector<bool> >(sz, vector<bool>(sz));  // Initially all light
 	isFunction = vector<vector<bool> >(sz, vector<bool>(sz));
-
-	// Compute ECC, draw modules
+	
+	// Draw modules
 	drawFunctionPatterns();
-	const vector<uint8_t> allCodewords = addEccAndInterleave(dataCodewords);
 	drawCodewords(allCodewords);
 	
 	// Do masking
+	AllocationTracker::enterStage(AllocationTracker::MASKING);
+	msk = applyBestMask(msk);
+	
+	AllocationTracker::enterStage(AllocationTracker::MODULES);
+	shareModules();
+	std::vector<std::vector<bool> > temp;
+	modules.swap(temp);
+	std::vector<std::vector<bool> > temp2;
+	isFunction.swap(temp2);
+	return msk;
+}
+
+
+int QrCode::applyBestMask(int msk) {
+	if (msk == -1 && MASK_SEARCH == BIT_SLICED)
+		msk = chooseMask(getMaskLanes());
 	if (msk == -1) {  // Automatically choose best mask
 		long minPenalty = LONG_MAX;
 		for (int i = 0; i < 8; i++) {
@@ -378,13 +645,92 @@ QrCode::QrCode(int ver, Ecc ecl, const vector<uint8_t> &dataCodewords, int msk)
 		}
 	}
 	assert(0 <= msk && msk <= 7);
-	mask = msk;
 	applyMask(msk);  // Apply the final choice of mask
 	drawFormatBits(msk);  // Overwrite old format bits
-	
-	isFunction.clear();
-	std::vector<std::vector<bool> > temp;
-	isFunction.swap(temp);
+	return msk;
+}
+
+
+void QrCode::shareModules() {
+	const size_t rowBytes = static_cast<size_t>((size + 7) / 8);
+	vector<uint8_t> bits(static_cast<size_t>(size) * rowBytes);
+	for (int y = 0; y < size; y++) {
+		const vector<bool> &row = modules[static_cast<size_t>(y)];
+		for (int x = 0; x < size; x++) {
+			if (row[static_cast<size_t>(x)])
+				bits[static_cast<size_t>(y) * rowBytes + static_cast<size_t>(x >> 3)] |= 0x80 >> (x & 7);
+		}
+	}
+	shareModules(bits, rowBytes);
+}
+
+
+void QrCode::shareModules(vector<uint8_t> &bits, size_t rowBytes) {
+	SharedModules *sm = new SharedModules;
+	sm->refCount = 1;
+	sm->rowBytes = rowBytes;
+	sm->bits.swap(bits);
+	releaseModules(shared);
+	shared = sm;
+}
+
+
+void QrCode::retainModules(SharedModules *sm) {
+	if (sm == NULL)
+		return;  // Empty placeholder
+#if defined(__GNUC__)
+	__sync_add_and_fetch(&sm->refCount, 1);
+#else
+	sm->refCount++;
+#endif
+}
+
+
+void QrCode::releaseModules(SharedModules *sm) {
+	if (sm == NULL)
+		return;  // Empty placeholder
+#if defined(__GNUC__)
+	if (__sync_sub_and_fetch(&sm->refCount, 1) == 0)
+#else
+	if (--sm->refCount == 0)
+#endif
+		delete sm;
+}
+
+
+QrCode::QrCode() :
+		version(0),
+		size(0),
+		errorCorrectionLevel(LOW),
+		mask(0),
+		shared(NULL) {
+}
+
+
+QrCode::QrCode(const QrCode &other) :
+		version(other.version),
+		size(other.size),
+		errorCorrectionLevel(other.errorCorrectionLevel),
+		mask(other.mask),
+		shared(other.shared) {
+	retainModules(shared);
+}
+
+
+QrCode &QrCode::operator=(const QrCode &other) {
+	retainModules(other.shared);  // First, in case other is this
+	releaseModules(shared);
+	version = other.version;
+	size = other.size;
+	errorCorrectionLevel = other.errorCorrectionLevel;
+	mask = other.mask;
+	shared = other.shared;
+	return *this;
+}
+
+
+QrCode::~QrCode() {
+	releaseModules(shared);
 }
 
 
@@ -409,7 +755,83 @@ int QrCode::getMask() const {
 
 
 bool QrCode::getModule(int x, int y) const {
-	return 0 <= x && x < size && 0 <= y && y < size && module(x, y);
+	if (0 <= x && x < size && 0 <= y && y < size) {
+		const uint8_t *row = &shared->bits[static_cast<size_t>(y) * shared->rowBytes];
+		return (row[x >> 3] & (0x80 >> (x & 7))) != 0;
+	}
+	return false;
+}
+
+
+int QrCode::getPackedLineBytes(int border) const {
+	if (border < 0)
+		throw std::domain_error("Border must be non-negative");
+	return (size + 2 * border + 7) / 8;
+}
+
+
+void QrCode::getRowBits(int x, int y, int count, uint8_t *out) const {
+	packRowBits(shared != NULL ? &shared->bits[0] : NULL, shared != NULL ? shared->rowBytes : 0, size, x, y, count, out);
+}
+
+
+void QrCode::packRowBits(const uint8_t *bits, size_t rowBytes, int size, int x, int y, int count, uint8_t *out) {
+	if (count < 0)
+		throw std::domain_error("Invalid value");
+	std::memset(out, 0, static_cast<size_t>((count + 7) / 8));
+	if (y < 0 || y >= size)
+		return;
+	
+	// Only the part of the span inside the symbol has dark modules
+	const uint8_t *row = &bits[static_cast<size_t>(y) * rowBytes];
+	int begin = std::max(x, 0);
+	int end = static_cast<int>(std::min(static_cast<long>(x) + count, static_cast<long>(size)));
+	if (((begin - x) & 7) == 0 && (begin & 7) == 0) {
+		// Byte aligned, only the bits after the end of the span need to be cleared
+		if (end > begin) {
+			uint8_t *dest = out + ((begin - x) >> 3);
+			size_t numBytes = static_cast<size_t>((end - begin + 7) / 8);
+			std::memcpy(dest, row + (begin >> 3), numBytes);
+			if (((end - begin) & 7) != 0)
+				dest[numBytes - 1] &= static_cast<uint8_t>(0xFF << (8 - ((end - begin) & 7)));
+		}
+		return;
+	}
+	for (int i = begin; i < end; i++) {
+		if (row[i >> 3] & (0x80 >> (i & 7)))
+			out[(i - x) >> 3] |= 0x80 >> ((i - x) & 7);
+	}
+}
+
+
+void QrCode::getPackedRows(int border, uint8_t *out, size_t stride) const {
+	int lineBytes = getPackedLineBytes(border);
+	if (stride < static_cast<unsigned int>(lineBytes))
+		throw std::invalid_argument("Stride too small");
+	for (int y = -border; y < size + border; y++, out += stride)
+		getRowBits(-border, y, size + 2 * border, out);
+}
+
+
+void QrCode::getPackedColumns(int border, uint8_t *out, size_t stride) const {
+	int lineBytes = getPackedLineBytes(border);
+	if (stride < static_cast<unsigned int>(lineBytes))
+		throw std::invalid_argument("Stride too small");
+	int lines = size + 2 * border;
+	for (int i = 0; i < lines; i++)
+		std::memset(out + i * stride, 0, static_cast<size_t>(lineBytes));
+	
+	// Walk the rows once and scatter each dark module into its column
+	for (int y = 0; y < size; y++) {
+		const uint8_t *row = &shared->bits[static_cast<size_t>(y) * shared->rowBytes];
+		int bitIndex = y + border;
+		uint8_t bit = static_cast<uint8_t>(0x80 >> (bitIndex & 7));
+		uint8_t *column = out + border * stride + (bitIndex >> 3);
+		for (int x = 0; x < size; x++, column += stride) {
+			if (row[x >> 3] & (0x80 >> (x & 7)))
+				*column |= bit;
+		}
+	}
 }
 
 
@@ -443,13 +865,7 @@ void QrCode::drawFunctionPatterns() {
 
 
 void QrCode::drawFormatBits(int msk) {
-	// Calculate error correction code and pack bits
-	int data = getFormatBits(errorCorrectionLevel) << 3 | msk;  // errCorrLvl is uint2, msk is uint3
-	int rem = data;
-	for (int i = 0; i < 10; i++)
-		rem = (rem << 1) ^ ((rem >> 9) * 0x537);
-	int bits = (data << 10 | rem) ^ 0x5412;  // uint15
-	assert(bits >> 15 == 0);
+	int bits = getFormatWord(errorCorrectionLevel, msk);
 	
 	// Draw first copy
 	for (int i = 0; i <= 5; i++)
@@ -473,12 +889,7 @@ void QrCode::drawVersion() {
 	if (version < 7)
 		return;
 	
-	// Calculate error correction code and pack bits
-	int rem = version;  // version is uint6, in the range [7, 40]
-	for (int i = 0; i < 12; i++)
-		rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
-	long bits = static_cast<long>(version) << 12 | rem;  // uint18
-	assert(bits >> 18 == 0);
+	long bits = getVersionWord(version);
 	
 	// Draw two copies
 	for (int i = 0; i < 18; i++) {
@@ -534,33 +945,28 @@ vector<uint8_t> QrCode::addEccAndInterleave(const vector<uint8_t> &data) const {
 	int rawCodewords = getNumRawDataModules(version) / 8;
 	int numShortBlocks = numBlocks - rawCodewords % numBlocks;
 	int shortBlockLen = rawCodewords / numBlocks;
+	int shortDataLen = shortBlockLen - blockEccLen;
+	int numDataCodewords = static_cast<int>(data.size());
 	
-	// Split data into blocks and append ECC to each block
-	vector<vector<uint8_t> > blocks;
+	// Interleave (not concatenate) the bytes from every block into a single sequence. Data byte i of
+	// block j goes to column i, ECC byte i of block j to column i after all data; the extra data byte
+	// of the long blocks forms a column of its own that has no entries for the short blocks.
+	vector<uint8_t> result(static_cast<size_t>(rawCodewords));
 	const vector<uint8_t> rsDiv = reedSolomonComputeDivisor(blockEccLen);
-	for (int i = 0, k = 0; i < numBlocks; i++) {
-		vector<uint8_t> dat(data.begin() + k, data.begin() + (k + shortBlockLen - blockEccLen + (i < numShortBlocks ? 0 : 1)));
-		k += static_cast<int>(dat.size());
-		const vector<uint8_t> ecc = reedSolomonComputeRemainder(dat, rsDiv);
+	for (int j = 0, k = 0; j < numBlocks; j++) {
+		int datLen = shortDataLen + (j < numShortBlocks ? 0 : 1);
+		const uint8_t *dat = &data[static_cast<size_t>(k)];
+		k += datLen;
 		
-		dat.reserve(dat.size() + ecc.size());
-
-		if (i < numShortBlocks)
-			dat.push_back(0);
-		dat.insert(dat.end(), ecc.begin(), ecc.end());		
-		blocks.push_back(vector<uint8_t>());
-		blocks.back().swap(dat);    
+		for (int i = 0; i < shortDataLen; i++)
+			result[static_cast<size_t>(i * numBlocks + j)] = dat[i];
+		if (j >= numShortBlocks)
+			result[static_cast<size_t>(shortDataLen * numBlocks + j - numShortBlocks)] = dat[shortDataLen];
 	}
 	
-	// Interleave (not concatenate) the bytes from every block into a single sequence
-	vector<uint8_t> result;
-	for (size_t i = 0; i < blocks.at(0).size(); i++) {
-		for (size_t j = 0; j < blocks.size(); j++) {
-			// Skip the padding byte in short blocks
-			if (i != static_cast<unsigned int>(shortBlockLen - blockEccLen) || j >= static_cast<unsigned int>(numShortBlocks))
-				result.push_back(blocks.at(j).at(i));
-		}
-	}
+	// All blocks share the divisor, so the kernel of the CPU may divide several blocks at once
+	CpuDispatch::getReedSolomonKernel()(&data[0], numBlocks, numShortBlocks, shortDataLen,
+		&rsDiv[0], blockEccLen, &result[static_cast<size_t>(numDataCodewords)]);
 	assert(result.size() == static_cast<unsigned int>(rawCodewords));
 	return result;
 }
@@ -697,37 +1103,155 @@ long QrCode::getPenaltyScore() const {
 }
 
 
-vector<int> QrCode::getAlignmentPatternPositions() const {
-	if (version == 1)
-		return vector<int>();
-	else {
-		int numAlign = version / 7 + 2;
-		int step = (version * 8 + numAlign * 3 + 5) / (numAlign * 4 - 4) * 2;
-		vector<int> result;
-		result.reserve(numAlign);
-		for (int i = 0, pos = size - 7; i < numAlign - 1; i++, pos -= step)
-			result.insert(result.begin(), pos);
-		result.insert(result.begin(), 6);
-		return result;
+vector<uint8_t> QrCode::getMaskLanes() {
+	vector<uint8_t> result(static_cast<size_t>(size * size));
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			uint8_t color = module(x, y) ? 0xFF : 0x00;
+			bool function = isFunction.at(static_cast<size_t>(y)).at(static_cast<size_t>(x));
+			result[static_cast<size_t>(y * size + x)] = function ? color : color ^ getMaskInversions(x, y);
+		}
 	}
-}
-
-
-int QrCode::getNumRawDataModules(int ver) {
-	if (ver < MIN_VERSION || ver > MAX_VERSION)
-		throw std::domain_error("Version number out of range");
-	int result = (16 * ver + 128) * ver + 64;
-	if (ver >= 2) {
-		int numAlign = ver / 7 + 2;
-		result -= (25 * numAlign - 10) * numAlign - 55;
-		if (ver >= 7)
-			result -= 36;
+	
+	// The format bits are the only function modules that depend on the mask, all of them
+	// are in row and column 8. The other function modules there are copied unchanged.
+	for (int m = 0; m < 8; m++) {
+		drawFormatBits(m);
+		uint8_t bit = static_cast<uint8_t>(1 << m);
+		for (int i = 0; i < size; i++) {
+			size_t ui = static_cast<size_t>(i);
+			if (isFunction.at(8).at(ui)) {
+				uint8_t &lane = result[static_cast<size_t>(8 * size + i)];
+				lane = module(i, 8) ? lane | bit : lane & ~bit;
+			}
+			if (isFunction.at(ui).at(8)) {
+				uint8_t &lane = result[static_cast<size_t>(i * size + 8)];
+				lane = module(8, i) ? lane | bit : lane & ~bit;
+			}
+		}
 	}
-	assert(208 <= result && result <= 29648);
 	return result;
 }
 
 
+int QrCode::chooseMask(const vector<uint8_t> &lanes) const {
+	if (lanes.size() != static_cast<unsigned int>(size * size))
+		throw std::invalid_argument("Invalid argument");
+	long penalties[8] = {0};
+	
+	// Adjacent modules in row (pass 0) or column (pass 1) having same color, and finder-like patterns.
+	// Every lane whose color changes ends its run; lanes that keep their color need no work.
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < size; i++) {
+			const uint8_t *p = &lanes[static_cast<size_t>(pass == 0 ? i * size : i)];
+			int step = (pass == 0 ? 1 : size);
+			uint8_t runColors = 0;
+			int runStart[8] = {0};
+			int runHistory[8][7] = {{0}};
+			for (int j = 0; j < size; j++, p += step) {
+				uint8_t changed = *p ^ runColors;
+				for (int m = 0; changed != 0; m++, changed >>= 1) {
+					if ((changed & 1) == 0)
+						continue;
+					int runLength = j - runStart[m];
+					penalties[m] += getRunPenalty(runLength);
+					finderPenaltyAddHistory(runLength, runHistory[m]);
+					if (!getBit(runColors, m))
+						penalties[m] += finderPenaltyCountPatterns(runHistory[m]) * PENALTY_N3;
+					runStart[m] = j;
+				}
+				runColors = *p;
+			}
+			for (int m = 0; m < 8; m++) {
+				int runLength = size - runStart[m];
+				penalties[m] += getRunPenalty(runLength);
+				penalties[m] += finderPenaltyTerminateAndCount(getBit(runColors, m), runLength, runHistory[m]) * PENALTY_N3;
+			}
+		}
+	}
+	
+	// 2*2 blocks of modules having same color, and dark modules, counted for all lanes at once
+	uint8_t sameBlocks[16] = {0};
+	uint8_t dark[16] = {0};
+	for (int y = 0; y < size; y++) {
+		const uint8_t *row = &lanes[static_cast<size_t>(y * size)];
+		for (int x = 0; x < size; x++) {
+			addToLaneCounter(dark, row[x]);
+			if (x < size - 1 && y < size - 1) {
+				uint8_t color = row[x];
+				addToLaneCounter(sameBlocks, static_cast<uint8_t>(~(color ^ row[x + 1]) & ~(color ^ row[x + size])
+					& ~(color ^ row[x + size + 1])));
+			}
+		}
+	}
+	
+	int result = 0;
+	for (int m = 0; m < 8; m++) {
+		penalties[m] += getLaneCount(sameBlocks, m) * PENALTY_N2;
+		
+		// Balance of dark and light modules
+		long total = static_cast<long>(size) * size;  // Note that size is odd, so dark/total != 1/2
+		// Compute the smallest integer k >= 0 such that (45-5k)% <= dark/total <= (55+5k)%
+		int k = static_cast<int>((std::labs(getLaneCount(dark, m) * 20L - total * 10L) + total - 1) / total) - 1;
+		assert(0 <= k && k <= 9);
+		penalties[m] += k * PENALTY_N4;
+		if (penalties[m] < penalties[result])
+			result = m;
+	}
+	return result;
+}
+
+
+vector<int> QrCode::getAlignmentPatternPositions() const {
+	if (version == 1)
+		return vector<int>();
+	else {
+		int numAlign = version / 7 + 2;
+		int step = (version * 8 + numAlign * 3 + 5) / (numAlign * 4 - 4) * 2;
+		vector<int> result;
+		result.reserve(numAlign);
+		for (int i = 0, pos = size - 7; i < numAlign - 1; i++, pos -= step)
+			result.insert(result.begin(), pos);
+		result.insert(result.begin(), 6);
+		return result;
+	}
+}
+
+
+int QrCode::getNumRawDataModules(int ver) {
+	if (ver < MIN_VERSION || ver > MAX_VERSION)
+		throw std::domain_error("Version number out of range");
+	int result = (16 * ver + 128) * ver + 64;
+	if (ver >= 2) {
+		int numAlign = ver / 7 + 2;
+		result -= (25 * numAlign - 10) * numAlign - 55;
+		if (ver >= 7)
+			result -= 36;
+	}
+	assert(208 <= result && result <= 29648);
+	return result;
+}
+
+
+QrCode::Capacity QrCode::findVersion(const int usedBits[3], Ecc ecl, int minVersion, int maxVersion) {
+	Capacity result;
+	for (int version = minVersion; ; version++) {
+		result.usedBits = usedBits[(version + 7) / 17];
+		result.capacityBits = getNumDataCodewords(version, ecl) * 8;  // Number of data bits available
+		if (result.usedBits != -1 && result.usedBits <= result.capacityBits) {
+			result.version = version;  // This version number is found to be suitable
+			result.size = version * 4 + 17;
+			return result;
+		}
+		if (version >= maxVersion) {  // All versions in the range could not fit the given data
+			result.version = -1;
+			result.size = -1;
+			return result;
+		}
+	}
+}
+
+
 int QrCode::getNumDataCodewords(int ver, Ecc ecl) {
 	return getNumRawDataModules(ver) / 8
 		- ECC_CODEWORDS_PER_BLOCK    [static_cast<int>(ecl)][ver]
@@ -760,17 +1284,137 @@ vector<uint8_t> QrCode::reedSolomonComputeDivisor(int degree) {
 }
 
 
-vector<uint8_t> QrCode::reedSolomonComputeRemainder(const vector<uint8_t> &data, const vector<uint8_t> &divisor) {
-	vector<uint8_t> result(divisor.size());
-	for (size_t i = 0; i < data.size(); i++) {  // Polynomial division
-		uint8_t factor = data[i] ^ result.at(0);
-		result.erase(result.begin());
-		result.push_back(0);
-		for (size_t i = 0; i < result.size(); i++)
-			result.at(i) ^= reedSolomonMultiply(divisor.at(i), factor);
+void QrCode::reedSolomonComputeRemainder(const uint8_t *data, int dataLen, const uint8_t *divisor, int degree, uint8_t *result) {
+	std::memset(result, 0, static_cast<size_t>(degree));
+	for (int i = 0; i < dataLen; i++) {  // Polynomial division
+		uint8_t factor = data[i] ^ result[0];
+		for (int j = 0; j + 1 < degree; j++)
+			result[j] = result[j + 1] ^ reedSolomonMultiply(divisor[j], factor);
+		result[degree - 1] = reedSolomonMultiply(divisor[degree - 1], factor);
+	}
+}
+
+
+void QrCode::reedSolomonComputeRemainders(const uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const uint8_t *divisor, int degree, uint8_t *ecc) {
+	uint8_t rem[30];  // Largest number of ECC codewords per block
+	for (int b = 0; b < numBlocks; b++) {
+		int datLen = shortDataLen + (b < numShortBlocks ? 0 : 1);
+		reedSolomonComputeRemainder(data, datLen, divisor, degree, rem);
+		data += datLen;
+		for (int j = 0; j < degree; j++)
+			ecc[j * numBlocks + b] = rem[j];
+	}
+}
+
+
+#if defined(QRCODEGEN_X86_DISPATCH)
+__attribute__((target("ssse3")))
+void QrCode::reedSolomonComputeRemaindersSsse3(const uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const uint8_t *divisor, int degree, uint8_t *ecc) {
+	// Products of each divisor coefficient with every low and high nibble, so that the
+	// factors of all lanes are multiplied by two table shuffles
+	__m128i mulLow[30], mulHigh[30], rem[30];
+	uint8_t lane[16];
+	for (int i = 0; i < degree; i++) {
+		for (int x = 0; x < 16; x++)
+			lane[x] = reedSolomonMultiply(divisor[i], static_cast<uint8_t>(x));
+		mulLow[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lane));
+		for (int x = 0; x < 16; x++)
+			lane[x] = reedSolomonMultiply(divisor[i], static_cast<uint8_t>(x << 4));
+		mulHigh[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lane));
+	}
+	
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	for (int firstBlock = 0; firstBlock < numBlocks; firstBlock += 16) {
+		int count = std::min(numBlocks - firstBlock, 16);
+		for (int j = 0; j < degree; j++)
+			rem[j] = _mm_setzero_si128();
+		
+		// Short blocks get a leading zero, which leaves the remainder unchanged, so all lanes
+		// run for the same number of steps. Unused lanes divide zeros.
+		const uint8_t *starts[16];
+		for (int b = 0; b < count; b++) {
+			int j = firstBlock + b;
+			starts[b] = data + j * shortDataLen + std::max(j - numShortBlocks, 0);
+		}
+		std::memset(lane, 0, sizeof(lane));
+		for (int i = 0; i <= shortDataLen; i++) {  // Polynomial division
+			for (int b = 0; b < count; b++) {
+				if (firstBlock + b >= numShortBlocks)
+					lane[b] = starts[b][i];
+				else
+					lane[b] = (i == 0 ? 0 : starts[b][i - 1]);
+			}
+			__m128i factor = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lane)), rem[0]);
+			__m128i low  = _mm_and_si128(factor, nibble);
+			__m128i high = _mm_and_si128(_mm_srli_epi16(factor, 4), nibble);
+			for (int j = 0; j < degree; j++) {
+				__m128i product = _mm_xor_si128(_mm_shuffle_epi8(mulLow[j], low), _mm_shuffle_epi8(mulHigh[j], high));
+				rem[j] = _mm_xor_si128(j + 1 < degree ? rem[j + 1] : _mm_setzero_si128(), product);
+			}
+		}
+		
+		for (int j = 0; j < degree; j++) {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lane), rem[j]);
+			for (int b = 0; b < count; b++)
+				ecc[j * numBlocks + firstBlock + b] = lane[b];
+		}
+	}
+}
+
+
+__attribute__((target("avx2")))
+void QrCode::reedSolomonComputeRemaindersAvx2(const uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const uint8_t *divisor, int degree, uint8_t *ecc) {
+	// Same as the SSSE3 kernel; the shuffles work within each 128-bit half, so both halves get the tables
+	__m256i mulLow[30], mulHigh[30], rem[30];
+	uint8_t lane[32];
+	for (int i = 0; i < degree; i++) {
+		for (int x = 0; x < 32; x++)
+			lane[x] = reedSolomonMultiply(divisor[i], static_cast<uint8_t>(x & 0x0F));
+		mulLow[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lane));
+		for (int x = 0; x < 32; x++)
+			lane[x] = reedSolomonMultiply(divisor[i], static_cast<uint8_t>((x & 0x0F) << 4));
+		mulHigh[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lane));
+	}
+	
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	for (int firstBlock = 0; firstBlock < numBlocks; firstBlock += 32) {
+		int count = std::min(numBlocks - firstBlock, 32);
+		for (int j = 0; j < degree; j++)
+			rem[j] = _mm256_setzero_si256();
+		
+		const uint8_t *starts[32];
+		for (int b = 0; b < count; b++) {
+			int j = firstBlock + b;
+			starts[b] = data + j * shortDataLen + std::max(j - numShortBlocks, 0);
+		}
+		std::memset(lane, 0, sizeof(lane));
+		for (int i = 0; i <= shortDataLen; i++) {  // Polynomial division
+			for (int b = 0; b < count; b++) {
+				if (firstBlock + b >= numShortBlocks)
+					lane[b] = starts[b][i];
+				else
+					lane[b] = (i == 0 ? 0 : starts[b][i - 1]);
+			}
+			__m256i factor = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lane)), rem[0]);
+			__m256i low  = _mm256_and_si256(factor, nibble);
+			__m256i high = _mm256_and_si256(_mm256_srli_epi16(factor, 4), nibble);
+			for (int j = 0; j < degree; j++) {
+				__m256i product = _mm256_xor_si256(_mm256_shuffle_epi8(mulLow[j], low), _mm256_shuffle_epi8(mulHigh[j], high));
+				rem[j] = _mm256_xor_si256(j + 1 < degree ? rem[j + 1] : _mm256_setzero_si256(), product);
+			}
+		}
+		
+		for (int j = 0; j < degree; j++) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(lane), rem[j]);
+			for (int b = 0; b < count; b++)
+				ecc[j * numBlocks + firstBlock + b] = lane[b];
+		}
 	}
-	return result;
 }
+#endif
 
 
 uint8_t QrCode::reedSolomonMultiply(uint8_t x, uint8_t y) {
@@ -818,8 +1462,521 @@ bool QrCode::getBit(long x, int i) {
 }
 
 
+uint8_t QrCode::getMaskInversions(int x, int y) {
+	int result = 0;
+	result |= ((x + y) % 2 == 0                  ) << 0;
+	result |= (y % 2 == 0                        ) << 1;
+	result |= (x % 3 == 0                        ) << 2;
+	result |= ((x + y) % 3 == 0                  ) << 3;
+	result |= ((x / 3 + y / 2) % 2 == 0          ) << 4;
+	result |= (x * y % 2 + x * y % 3 == 0        ) << 5;
+	result |= ((x * y % 2 + x * y % 3) % 2 == 0  ) << 6;
+	result |= (((x + y) % 2 + x * y % 3) % 2 == 0) << 7;
+	return static_cast<uint8_t>(result);
+}
+
+
+long QrCode::getRunPenalty(int runLength) {
+	return runLength >= 5 ? PENALTY_N1 + runLength - 5 : 0;
+}
+
+
+void QrCode::addToLaneCounter(uint8_t counter[16], uint8_t lanes) {
+	// Add with carry, one bit position of all 8 counters at a time
+	for (int i = 0; lanes != 0 && i < 16; i++) {
+		uint8_t carry = counter[i] & lanes;
+		counter[i] ^= lanes;
+		lanes = carry;
+	}
+}
+
+
+long QrCode::getLaneCount(const uint8_t counter[16], int lane) {
+	long result = 0;
+	for (int i = 15; i >= 0; i--)
+		result = result << 1 | ((counter[i] >> lane) & 1);
+	return result;
+}
+
+
+/*---- Class QrSequenceEncoder ----*/
+
+QrSequenceEncoder::QrSequenceEncoder(QrCode::Ecc ecl, int minVersion, int maxVersion, int mask, bool boostEcl) :
+		errorCorrectionLevel(ecl),
+		minVersion(minVersion),
+		maxVersion(maxVersion),
+		mask(mask),
+		boostEcl(boostEcl),
+		incremental(false) {
+	if (!(QrCode::MIN_VERSION <= minVersion && minVersion <= maxVersion && maxVersion <= QrCode::MAX_VERSION) || mask < -1 || mask > 7)
+		throw std::invalid_argument("Invalid value");
+}
+
+
+QrCode QrSequenceEncoder::encodeText(const char *text) {
+	return encodeSegments(QrSegment::makeSegments(text));
+}
+
+
+QrCode QrSequenceEncoder::encodeSegments(const vector<QrSegment> &segs) {
+	QrCode::Capacity capacity = QrCode::planSegments(segs, errorCorrectionLevel, minVersion, maxVersion);
+	if (capacity.version == -1)
+		QrCode::throwStatus(capacity.usedBits == -1 ? QrCode::SEGMENT_TOO_LONG : QrCode::DATA_TOO_LONG, capacity);
+	
+	int version = capacity.version;
+	QrCode::Ecc ecl = boostEcl ? QrCode::getBoostedEcl(version, errorCorrectionLevel, capacity.usedBits) : errorCorrectionLevel;
+	vector<uint8_t> newData = QrCode::makeDataCodewords(segs, version, ecl, capacity.usedBits);
+	
+	incremental = (work.version == version && work.errorCorrectionLevel == ecl);
+	if (!incremental) {
+		dataCodewords.swap(newData);
+		rebuild(version, ecl);
+	} else if (newData == dataCodewords) {
+		return last;  // Same payload as before
+	} else {
+		update(newData);
+	}
+	
+	// Mask a finished copy, then undo the mask so the next payload starts from unmasked modules
+	int msk = work.applyBestMask(mask);
+	work.mask = msk;
+	work.shareModules();
+	last = work;
+	work.applyMask(msk);
+	return last;
+}
+
+
+bool QrSequenceEncoder::wasIncremental() const {
+	return incremental;
+}
+
+
+void QrSequenceEncoder::rebuild(int version, QrCode::Ecc ecl) {
+	work.version = version;
+	work.size = version * 4 + 17;
+	work.errorCorrectionLevel = ecl;
+	size_t sz = static_cast<size_t>(work.size);
+	work.modules    = vector<vector<bool> >(sz, vector<bool>(sz));  // Initially all light
+	work.isFunction = vector<vector<bool> >(sz, vector<bool>(sz));
+	work.drawFunctionPatterns();
+	allCodewords = work.addEccAndInterleave(dataCodewords);
+	work.drawCodewords(allCodewords);
+	rsDivisor = QrCode::reedSolomonComputeDivisor(QrCode::ECC_CODEWORDS_PER_BLOCK[static_cast<int>(ecl)][version]);
+	
+	// Remember where every codeword bit was drawn, with the zigzag scan of QrCode::drawCodewords()
+	bitPositions.clear();
+	bitPositions.reserve(allCodewords.size() * 8);
+	for (int right = work.size - 1; right >= 1; right -= 2) {  // Index of right column in each column pair
+		if (right == 6)
+			right = 5;
+		bool upward = ((right + 1) & 2) == 0;
+		for (int vert = 0; vert < work.size; vert++) {  // Vertical counter
+			int y = upward ? work.size - 1 - vert : vert;  // Actual y coordinate
+			for (int x = right; x >= right - 1; x--) {
+				if (!work.isFunction[static_cast<size_t>(y)][static_cast<size_t>(x)] && bitPositions.size() < allCodewords.size() * 8)
+					bitPositions.push_back(static_cast<uint16_t>(y * work.size + x));
+			}
+		}
+	}
+	assert(bitPositions.size() == allCodewords.size() * 8);
+}
+
+
+void QrSequenceEncoder::update(const vector<uint8_t> &newData) {
+	// Same block layout as QrCode::addEccAndInterleave()
+	int version = work.version;
+	int ecl = static_cast<int>(work.errorCorrectionLevel);
+	int numBlocks = QrCode::NUM_ERROR_CORRECTION_BLOCKS[ecl][version];
+	int blockEccLen = QrCode::ECC_CODEWORDS_PER_BLOCK  [ecl][version];
+	int rawCodewords = QrCode::getNumRawDataModules(version) / 8;
+	int numShortBlocks = numBlocks - rawCodewords % numBlocks;
+	int shortDataLen = rawCodewords / numBlocks - blockEccLen;
+	int numDataCodewords = static_cast<int>(dataCodewords.size());
+	
+	uint8_t delta[256];  // Larger than any block
+	uint8_t ecc[30];  // Largest number of ECC codewords per block
+	for (int j = 0, k = 0; j < numBlocks; j++) {
+		int datLen = shortDataLen + (j < numShortBlocks ? 0 : 1);
+		
+		// Store the changed data bytes of this block and redraw them
+		int first = -1;
+		for (int i = 0; i < datLen; i++, k++) {
+			delta[i] = newData[static_cast<size_t>(k)] ^ dataCodewords[static_cast<size_t>(k)];
+			if (delta[i] == 0)
+				continue;
+			if (first == -1)
+				first = i;
+			dataCodewords[static_cast<size_t>(k)] = newData[static_cast<size_t>(k)];
+			int index = (i < shortDataLen ? i * numBlocks + j : shortDataLen * numBlocks + j - numShortBlocks);
+			allCodewords[static_cast<size_t>(index)] ^= delta[i];
+			drawCodeword(index);
+		}
+		if (first == -1)
+			continue;
+		
+		// The ECC of the new data is the old ECC plus the ECC of the difference. Leading
+		// zero bytes of the difference don't change the remainder, so they are skipped.
+		QrCode::reedSolomonComputeRemainder(&delta[first], datLen - first, &rsDivisor[0], blockEccLen, ecc);
+		for (int i = 0; i < blockEccLen; i++) {
+			if (ecc[i] == 0)
+				continue;
+			int index = numDataCodewords + i * numBlocks + j;
+			allCodewords[static_cast<size_t>(index)] ^= ecc[i];
+			drawCodeword(index);
+		}
+	}
+}
+
+
+void QrSequenceEncoder::drawCodeword(int index) {
+	uint8_t codeword = allCodewords[static_cast<size_t>(index)];
+	size_t sz = static_cast<size_t>(work.size);
+	for (int i = 0; i < 8; i++) {
+		size_t pos = bitPositions[static_cast<size_t>(index * 8 + i)];
+		work.modules[pos / sz][pos % sz] = QrCode::getBit(codeword, 7 - i);
+	}
+}
+
+
+
+/*---- Packed archives ----*/
+
+// Layout of packed archives, see ArchiveWriter
+static const uint8_t ARCHIVE_MAGIC[4] = {'Q', 'R', 'P', 'K'};
+static const int ARCHIVE_FORMAT = 1;
+static const int ARCHIVE_HEADER_SIZE = 16;
+static const int ARCHIVE_ENTRY_SIZE = 16;
+static const unsigned long ARCHIVE_MAX_SIZE = 0x7FFFFFFFUL;  // Largest fseek() offset with a 32-bit long
+
+
+// Stores the given value little endian.
+static void putLittleEndian(uint32_t value, uint8_t *out, int numBytes) {
+	for (int i = 0; i < numBytes; i++, value >>= 8)
+		out[i] = static_cast<uint8_t>(value);
+}
+
+
+// Reads a little endian value.
+static uint32_t getLittleEndian(const uint8_t *in, int numBytes) {
+	uint32_t result = 0;
+	for (int i = numBytes - 1; i >= 0; i--)
+		result = (result << 8) | in[i];
+	return result;
+}
+
+
+ArchiveWriter::ArchiveWriter(std::FILE *output, unsigned long capacity) :
+		output(output),
+		capacity(capacity),
+		count(0),
+		end(ARCHIVE_HEADER_SIZE) {
+	// The index must end within the size limit
+	if (capacity > (ARCHIVE_MAX_SIZE - ARCHIVE_HEADER_SIZE) / ARCHIVE_ENTRY_SIZE)
+		throw std::domain_error("Invalid value");
+	
+	uint8_t header[ARCHIVE_HEADER_SIZE];
+	std::memcpy(header, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+	putLittleEndian(ARCHIVE_FORMAT, &header[4], 2);
+	putLittleEndian(ARCHIVE_ENTRY_SIZE, &header[6], 2);
+	putLittleEndian(0, &header[8], 4);
+	putLittleEndian(capacity, &header[12], 4);
+	seek(0);
+	write(header, sizeof(header));
+	
+	// Reserve the index, unused entries stay zero
+	uint8_t entry[ARCHIVE_ENTRY_SIZE] = {0};
+	for (unsigned long i = 0; i < capacity; i++, end += ARCHIVE_ENTRY_SIZE)
+		write(entry, sizeof(entry));
+}
+
+
+void ArchiveWriter::append(const QrCode &qr, const char *payload) {
+	if (count >= capacity)
+		throw std::length_error("Archive is full");
+	
+	// Rows without quiet zone, the same layout as the modules of QrCode
+	size_t rowBytes = static_cast<size_t>(qr.getPackedLineBytes(0));
+	vector<uint8_t> bits(rowBytes * static_cast<size_t>(qr.getSize()));
+	qr.getPackedRows(0, &bits[0], rowBytes);
+	if (bits.size() > ARCHIVE_MAX_SIZE - end)  // Written this way as end + size can wrap around
+		throw std::length_error("Archive exceeds 2 GiB");
+	seek(end);
+	write(&bits[0], bits.size());
+	
+	uint8_t entry[ARCHIVE_ENTRY_SIZE];
+	putLittleEndian(end, &entry[0], 4);
+	entry[4] = static_cast<uint8_t>(qr.getVersion());
+	entry[5] = static_cast<uint8_t>(qr.getErrorCorrectionLevel());
+	entry[6] = static_cast<uint8_t>(qr.getMask());
+	entry[7] = 0;
+	putLittleEndian(getPayloadHash(payload), &entry[8], 4);
+	putLittleEndian(static_cast<uint32_t>(bits.size()), &entry[12], 4);
+	seek(ARCHIVE_HEADER_SIZE + count * ARCHIVE_ENTRY_SIZE);
+	write(entry, sizeof(entry));
+	
+	end += bits.size();
+	count++;
+}
+
+
+void ArchiveWriter::finish() {
+	uint8_t value[4];
+	putLittleEndian(count, value, 4);
+	seek(8);
+	write(value, sizeof(value));
+	seek(end);
+	if (std::fflush(output) != 0)
+		throw std::runtime_error("Error writing the archive");
+}
+
+
+unsigned long ArchiveWriter::getCount() const {
+	return count;
+}
+
+
+uint32_t ArchiveWriter::getPayloadHash(const char *payload) {
+	uint32_t hash = 0x811C9DC5UL;
+	for (const char *p = payload; *p != '\0'; p++) {
+		hash ^= static_cast<uint8_t>(*p);
+		hash *= 0x01000193UL;
+	}
+	return hash;
+}
+
+
+void ArchiveWriter::write(const uint8_t *data, size_t length) {
+	if (std::fwrite(data, 1, length, output) != length)
+		throw std::runtime_error("Error writing the archive");
+}
+
+
+void ArchiveWriter::seek(unsigned long offset) {
+	if (std::fseek(output, static_cast<long>(offset), SEEK_SET) != 0)
+		throw std::runtime_error("Error writing the archive");
+}
+
+
+SymbolView::SymbolView(const uint8_t *entry, const uint8_t *bits) :
+		version(entry[4]),
+		size(entry[4] * 4 + 17),
+		errorCorrectionLevel(static_cast<QrCode::Ecc>(entry[5])),
+		mask(entry[6]),
+		payloadHash(getLittleEndian(&entry[8], 4)),
+		bits(bits),
+		rowBytes(static_cast<size_t>((entry[4] * 4 + 17 + 7) / 8)) {}
+
+
+int SymbolView::getVersion() const {
+	return version;
+}
+
+
+int SymbolView::getSize() const {
+	return size;
+}
+
+
+QrCode::Ecc SymbolView::getErrorCorrectionLevel() const {
+	return errorCorrectionLevel;
+}
+
+
+int SymbolView::getMask() const {
+	return mask;
+}
+
+
+uint32_t SymbolView::getPayloadHash() const {
+	return payloadHash;
+}
+
+
+bool SymbolView::getModule(int x, int y) const {
+	if (0 <= x && x < size && 0 <= y && y < size) {
+		const uint8_t *row = &bits[static_cast<size_t>(y) * rowBytes];
+		return (row[x >> 3] & (0x80 >> (x & 7))) != 0;
+	}
+	return false;
+}
+
+
+int SymbolView::getPackedLineBytes(int border) const {
+	if (border < 0)
+		throw std::domain_error("Border must be non-negative");
+	return (size + 2 * border + 7) / 8;
+}
+
+
+void SymbolView::getRowBits(int x, int y, int count, uint8_t *out) const {
+	QrCode::packRowBits(bits, rowBytes, size, x, y, count, out);
+}
+
+
+void SymbolView::getPackedRows(int border, uint8_t *out, size_t stride) const {
+	int lineBytes = getPackedLineBytes(border);
+	if (stride < static_cast<unsigned int>(lineBytes))
+		throw std::invalid_argument("Stride too small");
+	for (int y = -border; y < size + border; y++, out += stride)
+		getRowBits(-border, y, size + 2 * border, out);
+}
+
+
+ArchiveReader::ArchiveReader(const uint8_t *data, size_t length) :
+		data(data),
+		length(length),
+		count(0) {
+	if (length < static_cast<size_t>(ARCHIVE_HEADER_SIZE) || std::memcmp(data, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0
+			|| getLittleEndian(&data[4], 2) != ARCHIVE_FORMAT || getLittleEndian(&data[6], 2) != ARCHIVE_ENTRY_SIZE)
+		throw std::invalid_argument("Not a packed archive");
+	count = getLittleEndian(&data[8], 4);
+	unsigned long capacity = getLittleEndian(&data[12], 4);
+	if (count > capacity || capacity > (length - ARCHIVE_HEADER_SIZE) / ARCHIVE_ENTRY_SIZE)
+		throw std::invalid_argument("Not a packed archive");
+}
+
+
+unsigned long ArchiveReader::getCount() const {
+	return count;
+}
+
+
+SymbolView ArchiveReader::getSymbol(unsigned long n) const {
+	if (n >= count)
+		throw std::out_of_range("Symbol index out of range");
+	const uint8_t *entry = &data[ARCHIVE_HEADER_SIZE + n * ARCHIVE_ENTRY_SIZE];
+	unsigned long offset = getLittleEndian(&entry[0], 4);
+	unsigned long dataLength = getLittleEndian(&entry[12], 4);
+	int version = entry[4];
+	int size = version * 4 + 17;
+	if (version < QrCode::MIN_VERSION || version > QrCode::MAX_VERSION || entry[5] > 3 || entry[6] > 7
+			|| dataLength != static_cast<unsigned long>((size + 7) / 8) * size
+			|| offset > length || dataLength > length - offset)
+		throw std::invalid_argument("Invalid archive entry");
+	return SymbolView(entry, &data[offset]);
+}
+
+
+
+/*---- Class CpuDispatch ----*/
+
+CpuDispatch::Level CpuDispatch::supportedLevel = CpuDispatch::SCALAR;
+CpuDispatch::Level CpuDispatch::level = CpuDispatch::SCALAR;
+CpuDispatch::ReedSolomonKernel CpuDispatch::reedSolomonKernel = QrCode::reedSolomonComputeRemainders;
+CpuDispatch::Level CpuDispatch::kernelLevel = CpuDispatch::SCALAR;
+
+
+CpuDispatch::Level CpuDispatch::getSupportedLevel() {
+	initialize();
+	return supportedLevel;
+}
+
+
+CpuDispatch::Level CpuDispatch::getLevel() {
+	initialize();
+	return level;
+}
+
+
+void CpuDispatch::setLevel(Level lvl) {
+	initialize();
+	level = std::min(lvl, supportedLevel);
+	bindKernels();
+}
+
+
+const char *CpuDispatch::getLevelName(Level lvl) {
+	static const char *const NAMES[] = {"scalar", "sse2", "ssse3", "avx2", "avx512bw"};
+	return NAMES[static_cast<int>(lvl)];
+}
+
+
+const char *CpuDispatch::getKernelName() {
+	initialize();
+#if defined(QRCODEGEN_X86_DISPATCH)
+	return getLevelName(__atomic_load_n(&kernelLevel, __ATOMIC_RELAXED));
+#else
+	return getLevelName(kernelLevel);
+#endif
+}
+
+
+CpuDispatch::ReedSolomonKernel CpuDispatch::getReedSolomonKernel() {
+	initialize();
+#if defined(QRCODEGEN_X86_DISPATCH)
+	return __atomic_load_n(&reedSolomonKernel, __ATOMIC_ACQUIRE);
+#else
+	return reedSolomonKernel;
+#endif
+}
+
+
+void CpuDispatch::initialize() {
+	// GCC and Clang serialize the initialization of local statics, so racing first uses detect once
+	static const bool detected = detectLevel();
+	(void)detected;
+}
+
+
+bool CpuDispatch::detectLevel() {
+#if defined(QRCODEGEN_X86_DISPATCH)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		supportedLevel = SSE2;
+	if (supportedLevel == SSE2 && __builtin_cpu_supports("ssse3"))
+		supportedLevel = SSSE3;
+	if (supportedLevel == SSSE3 && __builtin_cpu_supports("avx2"))
+		supportedLevel = AVX2;
+	if (supportedLevel == AVX2 && __builtin_cpu_supports("avx512bw"))
+		supportedLevel = AVX512BW;
+#endif
+	level = supportedLevel;
+	
+	// The environment can only lower the level, unknown names are ignored
+	const char *name = std::getenv("QRCODEGEN_CPU_LEVEL");
+	if (name != NULL) {
+		for (int i = SCALAR; i <= AVX512BW; i++) {
+			if (std::strcmp(name, getLevelName(static_cast<Level>(i))) == 0)
+				level = std::min(static_cast<Level>(i), supportedLevel);
+		}
+	}
+	bindKernels();
+	return true;
+}
+
+
+void CpuDispatch::bindKernels() {
+	ReedSolomonKernel kernel = QrCode::reedSolomonComputeRemainders;
+	Level kernelLvl = SCALAR;
+#if defined(QRCODEGEN_X86_DISPATCH)
+	if (level >= AVX2) {
+		kernel = QrCode::reedSolomonComputeRemaindersAvx2;
+		kernelLvl = AVX2;
+	} else if (level >= SSSE3) {
+		kernel = QrCode::reedSolomonComputeRemaindersSsse3;
+		kernelLvl = SSSE3;
+	}
+	// Encoders on other threads see either the old or the new kernel, never a torn pointer
+	__atomic_store_n(&kernelLevel, kernelLvl, __ATOMIC_RELAXED);
+	__atomic_store_n(&reedSolomonKernel, kernel, __ATOMIC_RELEASE);
+#else
+	kernelLevel = kernelLvl;
+	reedSolomonKernel = kernel;
+#endif
+}
+
+
+
 /*---- Tables of constants ----*/
 
+#if defined(QRCODEGEN_SEQUENTIAL_MASK_SEARCH)
+const QrCode::MaskSearch QrCode::MASK_SEARCH = QrCode::SEQUENTIAL;
+#else
+const QrCode::MaskSearch QrCode::MASK_SEARCH = QrCode::BIT_SLICED;
+#endif
+
+
 const int QrCode::PENALTY_N1 =  3;
 const int QrCode::PENALTY_N2 =  3;
 const int QrCode::PENALTY_N3 = 40;
@@ -863,4 +2020,153 @@ void BitBuffer::appendBits(std::uint32_t val, int len) {
 		this->push_back(((val >> i) & 1) != 0);
 }
 
+
+
+/*---- Class AllocationTracker ----*/
+
+AllocationTracker *AllocationTracker::active = NULL;
+long AllocationTracker::lastSerial = 0;
+
+
+AllocationTracker::AllocationTracker() :
+		currentBytes(0),
+		stage(OTHER),
+		previous(active),
+		serial(++lastSerial) {
+	for (int i = 0; i < NUM_STAGES; i++) {
+		stats[i].allocations = 0;
+		stats[i].bytes = 0;
+		stats[i].peakBytes = 0;
+	}
+	active = this;
+}
+
+
+AllocationTracker::~AllocationTracker() {
+	active = previous;
+}
+
+
+const AllocationTracker::Stats &AllocationTracker::getStats(Stage stage) const {
+	if (stage < 0 || stage >= NUM_STAGES)
+		throw std::domain_error("Stage out of range");
+	return stats[stage];
+}
+
+
+AllocationTracker::Stats AllocationTracker::getTotal() const {
+	Stats total = {0, 0, 0};
+	for (int i = 0; i < NUM_STAGES; i++) {
+		total.allocations += stats[i].allocations;
+		total.bytes += stats[i].bytes;
+		total.peakBytes = std::max(total.peakBytes, stats[i].peakBytes);
+	}
+	return total;
+}
+
+
+long AllocationTracker::getCurrentBytes() const {
+	return currentBytes;
+}
+
+
+AllocationTracker::Stage AllocationTracker::getStage() const {
+	return stage;
+}
+
+
+void AllocationTracker::enterStage(Stage stage) {
+	if (active != NULL) {
+		active->stage = stage;
+		Stats &st = active->stats[stage];
+		st.peakBytes = std::max(st.peakBytes, active->currentBytes);
+	}
+}
+
+
+AllocationTracker::StageGuard::StageGuard(Stage stage) :
+		tracker(active),
+		previous(active != NULL ? active->stage : OTHER) {
+	enterStage(stage);
+}
+
+
+AllocationTracker::StageGuard::~StageGuard() {
+	if (tracker != NULL) {
+		tracker->stage = previous;
+		Stats &st = tracker->stats[previous];
+		st.peakBytes = std::max(st.peakBytes, tracker->currentBytes);
+	}
+}
+
+
+long AllocationTracker::recordAllocation(size_t size) {
+	if (active == NULL)
+		return 0;
+	Stats &st = active->stats[active->stage];
+	st.allocations++;
+	st.bytes += static_cast<long>(size);
+	active->currentBytes += static_cast<long>(size);
+	st.peakBytes = std::max(st.peakBytes, active->currentBytes);
+	return active->serial;
+}
+
+
+void AllocationTracker::recordFree(long serial, size_t size) {
+	// Only the tracker that counted the block may subtract it, if it still exists
+	for (AllocationTracker *tracker = active; tracker != NULL; tracker = tracker->previous) {
+		if (tracker->serial == serial) {
+			tracker->currentBytes -= static_cast<long>(size);
+			break;
+		}
+	}
+}
+
 }
+
+
+
+/*---- Allocation hooks (opt-in) ----*/
+
+#if defined(QRCODEGEN_COUNT_ALLOCATIONS)
+
+// Every block starts with its size and the tracker that counted it, padded to the strictest alignment
+union AllocationHeader {
+	struct {
+		std::size_t size;
+		long tracker;  // Serial number of the tracker, 0 if not counted
+	} info;
+	long double align;
+};
+
+
+void *operator new(std::size_t size) {
+	AllocationHeader *header = static_cast<AllocationHeader *>(std::malloc(sizeof(AllocationHeader) + size));
+	if (header == NULL)
+		throw std::bad_alloc();
+	header->info.size = size;
+	header->info.tracker = qrcodegen::AllocationTracker::recordAllocation(size);
+	return header + 1;
+}
+
+
+void *operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+
+void operator delete(void *ptr) {
+	if (ptr == NULL)
+		return;
+	AllocationHeader *header = static_cast<AllocationHeader *>(ptr) - 1;
+	if (header->info.tracker != 0)
+		qrcodegen::AllocationTracker::recordFree(header->info.tracker, header->info.size);
+	std::free(header);
+}
+
+
+void operator delete[](void *ptr) {
+	operator delete(ptr);
+}
+
+#endif
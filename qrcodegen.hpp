@@ -26,13 +26,26 @@
 #ifndef QRCODEGEN_HPP
 #define QRCODEGEN_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <string>
 #include <vector>
 
 
+// x86 builds with GCC or Clang get SIMD kernels that are selected at run time, see CpuDispatch
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define QRCODEGEN_X86_DISPATCH
+#endif
+
+
 namespace qrcodegen {
 
+class BitBuffer;
+class CpuDispatch;
+class QrSequenceEncoder;
+
+
 /* 
  * A segment of character/binary/control data in a QR Code symbol.
  * Instances of this class are immutable.
@@ -124,6 +137,13 @@ class QrSegment {
 	public: static std::vector<QrSegment> makeSegments(const char *text);
 	
 	
+	/* 
+	 * Returns the same segments as makeSegments() for the given text and the mode that classifyText()
+	 * returned for it, encoding the text in that mode right away instead of trying narrower modes first.
+	 */
+	public: static std::vector<QrSegment> makeSegments(const char *text, const Mode *md);
+	
+	
 	/* 
 	 * Returns a segment representing an Extended Channel Interpretation
 	 * (ECI) designator with the given assignment value.
@@ -148,6 +168,15 @@ class QrSegment {
 	public: static bool isAlphanumeric(const char *text);
 	
 	
+	/* 
+	 * Returns the mode of the single segment that makeSegments() builds for the given text, or NULL for
+	 * the empty string, in one pass over the text without building it. Stores the number of characters
+	 * in numChars, and in ascii whether all characters are below 0x80, which are the same in UTF-8
+	 * and in every ASCII based codepage.
+	 */
+	public: static const Mode *classifyText(const char *text, long &numChars, bool &ascii);
+	
+	
 	
 	/*---- Instance fields ----*/
 	
@@ -183,7 +212,8 @@ class QrSegment {
 	/* 
 	 * Creates a new QR Code segment with the given parameters and data.
 	 * The character count (numCh) must agree with the mode and the bit buffer length,
-	 * but the constraint isn't checked. The given bit buffer is moved and stored.
+	 * but the constraint isn't checked. The given bit buffer is moved (swapped) into the
+	 * segment without copying and left empty.
 	 */
 	public: QrSegment(const Mode &md, int numCh, std::vector<bool> &dt);
 	
@@ -208,17 +238,45 @@ class QrSegment {
 	public: const std::vector<bool> &getData() const;
 	
 	
+	/* 
+	 * Exchanges the contents of this segment with the given one without copying the data bits.
+	 */
+	public: void swap(QrSegment &other);
+	
+	
 	// (Package-private) Calculates the number of bits needed to encode the given segments at
 	// the given version. Returns a non-negative number if successful. Otherwise returns -1 if a
 	// segment has too many characters to fit its length field, or the total bits exceeds INT_MAX.
 	public: static int getTotalBits(const std::vector<QrSegment> &segs, int version);
 	
 	
-	/*---- Private constant ----*/
+	// (Package-private) Returns the number of data bits (excluding the mode and character count fields)
+	// of a segment with the given mode and number of characters. Not valid for ECI and kanji mode.
+	public: static long getDataBits(const Mode &md, long numChars);
+	
+	
+	/*---- Private helper functions ----*/
+	
+	// Appends the numeric mode bits of the leading decimal digits of the given text to
+	// the buffer. Returns a pointer to the first character that is not a digit.
+	private: static const char *appendNumeric(const char *text, BitBuffer &bb);
+	
+	
+	// Appends the alphanumeric mode bits of the leading characters of the given text that are in the
+	// alphanumeric set to the buffer. Returns a pointer to the first character that is not in the set.
+	private: static const char *appendAlphanumeric(const char *text, BitBuffer &bb);
+	
 	
-	/* The set of all legal characters in alphanumeric mode, where
-	 * each character value maps to the index in the string. */
-	private: static const char *ALPHANUMERIC_CHARSET;
+	/*---- Private constants ----*/
+	
+	/* Classification of all 256 byte values. For the characters legal in alphanumeric mode
+	 * the low 6 bits hold the character value (0 to 44) and CLASS_ALPHANUMERIC is set, decimal
+	 * digits also have CLASS_NUMERIC set. All bytes can be encoded in byte mode. */
+	private: static const std::uint8_t CHAR_CLASSES[256];
+	
+	private: static const std::uint8_t CLASS_NUMERIC      = 0x80;
+	private: static const std::uint8_t CLASS_ALPHANUMERIC = 0x40;
+	private: static const std::uint8_t CLASS_VALUE_MASK   = 0x3F;
 	
 };
 
@@ -259,6 +317,44 @@ class QrCode {
 	private: static int getFormatBits(Ecc ecl);
 	
 	
+	// Returns the 15 format bits (with their own error correction code) for the given
+	// error correction level and mask, as drawn by drawFormatBits().
+	private: static int getFormatWord(Ecc ecl, int msk);
+	
+	
+	// Returns the 18 version bits (with their own error correction code)
+	// for the given version in the range [7, 40], as drawn by drawVersion().
+	private: static long getVersionWord(int ver);
+	
+	
+	
+	/* 
+	 * The smallest version that holds a payload at one error correction level, and the
+	 * number of data bits used and available at that version. Returned by the planning functions.
+	 * If the payload fits no version in the range, version and size are -1 and the bit counts
+	 * are those of the largest version in the range (usedBits is -1 if a segment is too long
+	 * for its character count field).
+	 */
+	public: struct Capacity {
+		int version;       // Smallest version in the range that fits, or -1
+		int size;          // Width and height in modules of that version, or -1
+		int usedBits;      // Data bits of the payload, including mode and character count fields
+		int capacityBits;  // Data bits available at that version and error correction level
+	};
+	
+	
+	/* 
+	 * The outcome of the non-throwing encode functions. Each failure corresponds to
+	 * an exception of the throwing functions, which are built on top of them.
+	 */
+	public: enum Status {
+		SUCCESS,           // The QR Code was created
+		DATA_TOO_LONG,     // The data does not fit any version in the range (data_too_long)
+		SEGMENT_TOO_LONG,  // A segment is too long for its character count field (data_too_long)
+		INVALID_ARGUMENT   // The version range or the mask is invalid (std::invalid_argument)
+	};
+	
+	
 	
 	/*---- Static factory functions (high level) ----*/
 	
@@ -299,6 +395,108 @@ class QrCode {
 	
 	
 	
+	/*---- Static factory functions (non-throwing) ----*/
+	
+	/* 
+	 * Does the same as encodeText(), but reports data that does not fit by the returned status
+	 * instead of an exception. Text that is too long is rejected before any segment is built.
+	 * On success the QR Code is assigned to result, otherwise result is left unchanged. In both cases
+	 * capacity holds the capacity plan for the given error correction level (see planSegments()).
+	 */
+	public: static Status tryEncodeText(const char *text, Ecc ecl, QrCode &result, Capacity &capacity);
+	
+	
+	/* 
+	 * Does the same as encodeSegments(), reporting failures like tryEncodeText(). On INVALID_ARGUMENT
+	 * all fields of capacity are -1.
+	 */
+	public: static Status tryEncodeSegments(const std::vector<QrSegment> &segs, Ecc ecl, QrCode &result,
+		Capacity &capacity, int minVersion=1, int maxVersion=40, int mask=-1, bool boostEcl=true);
+	
+	
+	/* 
+	 * Returns the message of the exception that the throwing functions raise for the given failure.
+	 */
+	public: static std::string getStatusMessage(Status status, const Capacity &capacity);
+	
+	
+	
+	/*---- Static planning functions ----*/
+	
+	/* 
+	 * Returns the smallest version within the given range that holds the given segments at the given
+	 * error correction level, as encodeSegments() would choose it before boosting the error correction
+	 * level, and how many data bits are used and available. No QR Code is built, so this is cheap.
+	 */
+	public: static Capacity planSegments(const std::vector<QrSegment> &segs, Ecc ecl,
+		int minVersion=1, int maxVersion=40);
+	
+	
+	/* 
+	 * Does the same as planSegments() for a single segment of the given mode and number of characters
+	 * (e.g. from QrSegment::classifyText()) without building it. A NULL mode stands for no segment.
+	 * Not valid for ECI and kanji mode.
+	 */
+	public: static Capacity planSegment(const QrSegment::Mode *md, long numChars, Ecc ecl,
+		int minVersion=1, int maxVersion=40);
+	
+	
+	/* 
+	 * Returns the capacity plan of the given UTF-8 text for each of the 4 error correction levels (indexed
+	 * by Ecc), as encodeText() would encode it. Neither segments nor modules are built, nothing is allocated.
+	 */
+	public: static void planText(const char *text, Capacity plans[4]);
+	
+	
+	// Computes the bit counts that findVersion() expects for the single segment of the given mode and number
+	// of characters, as makeSegments() builds it. A NULL mode stands for the empty text, which has no segment.
+	private: static void getTextBits(const QrSegment::Mode *md, long numChars, int usedBits[3]);
+	
+	
+	// Builds the data codewords of the given segments for the given version, which must hold them,
+	// and returns the QR Code. A helper function for tryEncodeSegments().
+	private: static QrCode encodeVersion(const std::vector<QrSegment> &segs, Ecc ecl, int version,
+		int dataUsedBits, int mask, bool boostEcl);
+	
+	
+	// Throws the exception for the given failure. A helper function for the throwing encode functions.
+	private: static void throwStatus(Status status, const Capacity &capacity);
+	
+	
+	// Returns the highest error correction level, but at least the given one, at which
+	// the data still fits in the given version.
+	private: static Ecc getBoostedEcl(int version, Ecc ecl, int dataUsedBits);
+	
+	
+	// Concatenates the given segments with terminator and padding into the data codewords of
+	// the given version and error correction level, which must hold the dataUsedBits bits.
+	private: static std::vector<std::uint8_t> makeDataCodewords(const std::vector<QrSegment> &segs,
+		int version, Ecc ecl, int dataUsedBits);
+	
+	
+	
+	/*---- Mask search ----*/
+	
+	/* 
+	 * The ways of choosing the mask when a QR Code is created with automatic masking (mask = -1).
+	 * Both choose the same mask. SEQUENTIAL applies each of the 8 masks in turn and scores
+	 * the whole symbol each time. BIT_SLICED holds the colors of a module under all 8 masks
+	 * in one byte and scores all masks together in one sweep over the symbol.
+	 */
+	public: enum MaskSearch {
+		SEQUENTIAL,
+		BIT_SLICED
+	};
+	
+	
+	/* 
+	 * The way the mask is chosen, fixed at build time. This is BIT_SLICED unless the library
+	 * is built with QRCODEGEN_SEQUENTIAL_MASK_SEARCH defined, which is meant for testing only.
+	 */
+	public: static const MaskSearch MASK_SEARCH;
+	
+	
+	
 	/*---- Instance fields ----*/
 	
 	// Immutable scalar parameters:
@@ -321,17 +519,36 @@ class QrCode {
 	
 	// Private grids of modules/pixels, with dimensions of size*size:
 	
-	// The modules of this QR Code (false = light, true = dark).
-	// Immutable after constructor finishes. Accessed through getModule().
+	// The modules of this QR Code (false = light, true = dark) while the constructor draws
+	// them on the heap. Discarded when constructor finishes, then the modules are in shared.
 	private: std::vector<std::vector<bool> > modules;
 	
 	// Indicates function modules that are not subjected to masking. Discarded when constructor finishes.
 	private: std::vector<std::vector<bool> > isFunction;
 	
+	// The finished modules of a QR Code, packed 8 per byte with the leftmost module in the most
+	// significant bit (1 = dark), rowBytes bytes per row. Immutable once built and shared by all
+	// copies of the QR Code, the last copy frees it.
+	private: struct SharedModules {
+		long refCount;  // Changed atomically where the compiler supports it
+		std::size_t rowBytes;
+		std::vector<std::uint8_t> bits;
+	};
+	
+	// The finished modules of this QR Code. Accessed through getModule().
+	private: SharedModules *shared;
+	
 	
 	
 	/*---- Constructor (low level) ----*/
 	
+	/* 
+	 * Creates an empty placeholder of version 0 and size 0 without any modules, e.g. to
+	 * be assigned the result of the non-throwing encode functions. All modules are light.
+	 */
+	public: QrCode();
+	
+	
 	/* 
 	 * Creates a new QR Code with the given version number,
 	 * error correction level, data codeword bytes, and mask number.
@@ -341,6 +558,22 @@ class QrCode {
 	public: QrCode(int ver, Ecc ecl, const std::vector<std::uint8_t> &dataCodewords, int msk);
 	
 	
+	/* 
+	 * Creates a copy of the given QR Code. The modules are shared, not copied, so this takes
+	 * constant time. Copies can be used from different threads like the original.
+	 */
+	public: QrCode(const QrCode &other);
+	
+	
+	/* 
+	 * Makes this QR Code a copy of the given one, in constant time like the copy constructor.
+	 */
+	public: QrCode &operator=(const QrCode &other);
+	
+	
+	public: ~QrCode();
+	
+	
 	
 	/*---- Public instance methods ----*/
 	
@@ -376,6 +609,76 @@ class QrCode {
 	public: bool getModule(int x, int y) const;
 	
 	
+	/* 
+	 * Returns the number of bytes of a packed row or column of this QR Code with a quiet zone
+	 * of border light modules on each side, which is (getSize() + 2 * border + 7) / 8.
+	 */
+	public: int getPackedLineBytes(int border) const;
+	
+	
+	/* 
+	 * Packs the colors of count modules of row y, starting at column x, into the given buffer: 8 modules
+	 * per byte, the leftmost one in the most significant bit, 1 for dark. Coordinates out of bounds are
+	 * light like with getModule(), so x can be negative to include a quiet zone. Writes (count + 7) / 8
+	 * bytes, unused bits of the last byte are 0.
+	 */
+	public: void getRowBits(int x, int y, int count, std::uint8_t *out) const;
+	
+	
+	/* 
+	 * Packs the whole QR Code with a quiet zone of border light modules on each side, row by row
+	 * like getRowBits(). Row i (including the quiet zone) starts at out + i * stride, the stride must
+	 * be at least getPackedLineBytes(border). Bytes between the rows are left unchanged.
+	 */
+	public: void getPackedRows(int border, std::uint8_t *out, std::size_t stride) const;
+	
+	
+	/* 
+	 * Packs the whole QR Code like getPackedRows(), but column by column (i.e. transposed), for output
+	 * devices that are fed in columns. Column i starts at out + i * stride, the topmost module of each
+	 * column is the most significant bit of its first byte.
+	 */
+	public: void getPackedColumns(int border, std::uint8_t *out, std::size_t stride) const;
+	
+	
+	/* 
+	 * (Package-private) Does the same as getRowBits() for a symbol of the given size whose rows are
+	 * packed in bits, rowBytes bytes per row without quiet zone. Shared with SymbolView.
+	 */
+	public: static void packRowBits(const std::uint8_t *bits, std::size_t rowBytes, int size,
+		int x, int y, int count, std::uint8_t *out);
+	
+	
+	
+	/*---- Private helper methods for constructor: Building the modules ----*/
+	
+	// Builds the modules on heap grids from the given codewords (data and error correction),
+	// choosing the best mask if msk is -1. Returns the mask that was applied.
+	private: int drawModules(const std::vector<std::uint8_t> &allCodewords, int msk);
+	
+	
+	
+	// Chooses the mask like the constructor if msk is -1, then applies it and draws the format bits.
+	// Returns the mask. The function modules must be marked and the codeword bits must be drawn.
+	private: int applyBestMask(int msk);
+	
+	
+	// Packs the finished modules of the grid into new shared modules. The grids are left unchanged.
+	private: void shareModules();
+	
+	
+	// Takes over the given packed rows (see SharedModules) as the shared modules of this QR Code.
+	private: void shareModules(std::vector<std::uint8_t> &bits, std::size_t rowBytes);
+	
+	
+	// Adds a reference to the given shared modules.
+	private: static void retainModules(SharedModules *sm);
+	
+	
+	// Drops a reference to the given shared modules and frees them if it was the last one.
+	private: static void releaseModules(SharedModules *sm);
+	
+	
 	
 	/*---- Private helper methods for constructor: Drawing function modules ----*/
 	
@@ -437,6 +740,17 @@ class QrCode {
 	private: long getPenaltyScore() const;
 	
 	
+	// Returns the colors of all modules under each mask, size*size bytes row by row. Bit i of a byte
+	// is the color with mask i applied and the format bits for mask i drawn. The function modules
+	// must be marked and the codeword bits must be drawn, and no mask may be applied.
+	private: std::vector<std::uint8_t> getMaskLanes();
+	
+	
+	// Calculates the penalty scores of all 8 masks from the given mask lanes (see getMaskLanes())
+	// in one sweep and returns the mask with the lowest score, the same one getPenaltyScore() finds.
+	private: int chooseMask(const std::vector<std::uint8_t> &lanes) const;
+	
+	
 	
 	/*---- Private helper functions ----*/
 	
@@ -452,6 +766,12 @@ class QrCode {
 	private: static int getNumRawDataModules(int ver);
 	
 	
+	// Returns the smallest version in the given range whose data capacity holds the payload. The payload
+	// size is given for each of the 3 ranges of character count field widths (versions 1 to 9, 10 to 26
+	// and 27 to 40) as numbers of bits, or -1 if a segment is too long for its character count field.
+	private: static Capacity findVersion(const int usedBits[3], Ecc ecl, int minVersion, int maxVersion);
+	
+	
 	// Returns the number of 8-bit data (i.e. not error correction) codewords contained in any
 	// QR Code of the given version number and error correction level, with remainder bits discarded.
 	// This stateless pure function could be implemented as a (40*4)-cell lookup table.
@@ -463,8 +783,26 @@ class QrCode {
 	private: static std::vector<std::uint8_t> reedSolomonComputeDivisor(int degree);
 	
 	
-	// Returns the Reed-Solomon error correction codeword for the given data and divisor polynomials.
-	private: static std::vector<std::uint8_t> reedSolomonComputeRemainder(const std::vector<std::uint8_t> &data, const std::vector<std::uint8_t> &divisor);
+	// Computes the Reed-Solomon error correction codeword for the given data and divisor polynomials,
+	// writing the degree bytes of the remainder to the given result array.
+	private: static void reedSolomonComputeRemainder(const std::uint8_t *data, int dataLen,
+		const std::uint8_t *divisor, int degree, std::uint8_t *result);
+	
+	
+	// Computes the Reed-Solomon remainders of all numBlocks blocks of data, with the block layout of
+	// addEccAndInterleave(). Byte j of the remainder of block b is written to ecc[j * numBlocks + b], so
+	// the result is already interleaved. Each block equals reedSolomonComputeRemainder().
+	private: static void reedSolomonComputeRemainders(const std::uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const std::uint8_t *divisor, int degree, std::uint8_t *ecc);
+	
+#if defined(QRCODEGEN_X86_DISPATCH)
+	// Do the same as reedSolomonComputeRemainders() with one block per byte lane of an SSSE3 or AVX2
+	// register, dividing 16 or 32 blocks at once. Only called if the CPU supports the instructions.
+	private: static void reedSolomonComputeRemaindersSsse3(const std::uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const std::uint8_t *divisor, int degree, std::uint8_t *ecc);
+	private: static void reedSolomonComputeRemaindersAvx2(const std::uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const std::uint8_t *divisor, int degree, std::uint8_t *ecc);
+#endif
 	
 	
 	// Returns the product of the two given field elements modulo GF(2^8/0x11D).
@@ -489,6 +827,23 @@ class QrCode {
 	private: static bool getBit(long x, int i);
 	
 	
+	// Returns the masks that invert the module at the given coordinates, bit i set for mask i.
+	private: static std::uint8_t getMaskInversions(int x, int y);
+	
+	
+	// Returns the penalty of a run of modules of the same color with the given length. A helper function for chooseMask().
+	private: static long getRunPenalty(int runLength);
+	
+	
+	// Adds 1 to the counter of each lane whose bit is set in the given byte. The counter is bit-sliced: byte i
+	// holds bit i of all 8 counts. A helper function for chooseMask(), counts up to 65535 per lane.
+	private: static void addToLaneCounter(std::uint8_t counter[16], std::uint8_t lanes);
+	
+	
+	// Returns the count of the given lane of a bit-sliced counter. A helper function for chooseMask().
+	private: static long getLaneCount(const std::uint8_t counter[16], int lane);
+	
+	
 	/*---- Constants and tables ----*/
 	
 	// The minimum version number supported in the QR Code Model 2 standard.
@@ -508,6 +863,303 @@ class QrCode {
 	private: static const std::int8_t ECC_CODEWORDS_PER_BLOCK[4][41];
 	private: static const std::int8_t NUM_ERROR_CORRECTION_BLOCKS[4][41];
 	
+	
+	friend class CpuDispatch;
+	friend class QrSequenceEncoder;
+	
+};
+
+
+
+/* 
+ * Encodes a sequence of payloads that differ only slightly, e.g. in a trailing counter, faster
+ * than encoding each one from scratch. While the version and error correction level stay the same,
+ * only the changed data codewords, the error correction codewords of their blocks (Reed-Solomon
+ * encoding is linear, so the difference is encoded and added) and the modules of those codewords are
+ * updated; then the mask is chosen again. Each result is identical to QrCode::encodeSegments() with
+ * the parameters given to the constructor. The encoder keeps the grids of the last symbol.
+ */
+class QrSequenceEncoder {
+	
+	/*---- Constructor ----*/
+	
+	// Creates an encoder for the given parameters, see QrCode::encodeSegments().
+	public: explicit QrSequenceEncoder(QrCode::Ecc ecl, int minVersion=1, int maxVersion=40,
+		int mask=-1, bool boostEcl=true);
+	
+	
+	/*---- Methods ----*/
+	
+	// Returns the same QR Code as QrCode::encodeSegments() for the given segments. Throws
+	// data_too_long if the segments do not fit, the previous state is kept in that case.
+	public: QrCode encodeSegments(const std::vector<QrSegment> &segs);
+	
+	// Returns the QR Code of the given UTF-8 text, like encodeSegments() with QrSegment::makeSegments().
+	public: QrCode encodeText(const char *text);
+	
+	// Returns true if the last QR Code was updated from the previous one instead of built from scratch.
+	public: bool wasIncremental() const;
+	
+	
+	/*---- Private helper methods ----*/
+	
+	// Builds the unmasked symbol of the data codewords from scratch.
+	private: void rebuild(int version, QrCode::Ecc ecl);
+	
+	// Changes the unmasked symbol to the given data codewords of the same version and error correction level.
+	private: void update(const std::vector<std::uint8_t> &newData);
+	
+	// Draws the bits of the codeword with the given index (data and error correction, interleaved) again.
+	private: void drawCodeword(int index);
+	
+	
+	/*---- Instance fields ----*/
+	
+	// Parameters given to the constructor
+	private: QrCode::Ecc errorCorrectionLevel;
+	private: int minVersion;
+	private: int maxVersion;
+	private: int mask;
+	private: bool boostEcl;
+	
+	// Unmasked symbol of the last payload with its grids, version 0 before the first one
+	private: QrCode work;
+	
+	// The last result
+	private: QrCode last;
+	
+	// Data codewords of the last payload, and all codewords (interleaved with the ECC)
+	private: std::vector<std::uint8_t> dataCodewords;
+	private: std::vector<std::uint8_t> allCodewords;
+	
+	// Reed-Solomon divisor for the ECC blocks of the current version and error correction level
+	private: std::vector<std::uint8_t> rsDivisor;
+	
+	// Module (y * size + x) of every codeword bit, in drawing order
+	private: std::vector<std::uint16_t> bitPositions;
+	
+	// Whether the last result was updated from the previous one
+	private: bool incremental;
+	
+	
+	/*---- Not copyable ----*/
+	
+	// The grids of work are not copied with QrCode, so a copy could not continue the sequence
+	private: QrSequenceEncoder(const QrSequenceEncoder &);
+	private: QrSequenceEncoder &operator=(const QrSequenceEncoder &);
+	
+};
+
+
+
+
+/* 
+ * Writes QR Codes into a packed archive, one binary file of many symbols for later stages
+ * like printing or verification. The layout, with all numbers little endian, is:
+ * - Header of 16 bytes: "QRPK", format version 1 (uint16), index entry size 16 (uint16),
+ *   number of symbols (uint32), capacity (uint32).
+ * - Index of capacity entries of 16 bytes: data offset (uint32), version, error correction level,
+ *   mask, 0 (uint8 each), FNV-1a hash of the payload (uint32), data length (uint32).
+ * - Data of each symbol: its rows without quiet zone, packed like QrCode::getRowBits().
+ * The index has a fixed size, so the entry of symbol n is found without parsing. Symbols are appended
+ * at the end of the file and their entries written in place, so the output must be seekable. Archives
+ * are limited to 2 GiB - 1 bytes, the largest offset that fseek() takes where long is 32 bits.
+ */
+class ArchiveWriter {
+	
+	/*---- Constructor ----*/
+	
+	// Starts an archive for up to capacity symbols in the given file, which must be opened for binary writing.
+	// Throws std::domain_error if the index alone would exceed the size limit.
+	public: ArchiveWriter(std::FILE *output, unsigned long capacity);
+	
+	
+	/*---- Methods ----*/
+	
+	// Appends the given QR Code with the hash of its payload. Throws std::length_error if the archive is full
+	// or its data would end beyond the size limit.
+	public: void append(const QrCode &qr, const char *payload);
+	
+	// Writes the final number of symbols into the header. The file stays open.
+	public: void finish();
+	
+	// Returns the number of symbols appended so far.
+	public: unsigned long getCount() const;
+	
+	// Returns the 32-bit FNV-1a hash of the given payload, as stored in the index.
+	public: static std::uint32_t getPayloadHash(const char *payload);
+	
+	
+	/*---- Private helper methods ----*/
+	
+	// Writes the given bytes at the current position of the file.
+	private: void write(const std::uint8_t *data, std::size_t length);
+	
+	// Moves to the given position of the file.
+	private: void seek(unsigned long offset);
+	
+	
+	/*---- Instance fields ----*/
+	
+	private: std::FILE *output;
+	private: unsigned long capacity;
+	private: unsigned long count;
+	
+	// End of the file, where the next symbol is written
+	private: unsigned long end;
+	
+};
+
+
+
+/* 
+ * A view of one symbol of a packed archive in memory. Nothing is copied, the view reads the
+ * archive's bytes, which must outlive it. It offers the module access and row export of QrCode.
+ */
+class SymbolView {
+	
+	/*---- Constructor ----*/
+	
+	// (Package-private) Creates a view of the given index entry and the data it points to.
+	public: SymbolView(const std::uint8_t *entry, const std::uint8_t *bits);
+	
+	
+	/*---- Public instance methods ----*/
+	
+	// Returns the version, size, error correction level and mask, like QrCode.
+	public: int getVersion() const;
+	public: int getSize() const;
+	public: QrCode::Ecc getErrorCorrectionLevel() const;
+	public: int getMask() const;
+	
+	// Returns the hash of the payload, see ArchiveWriter::getPayloadHash().
+	public: std::uint32_t getPayloadHash() const;
+	
+	// Return the color of a module or pack rows, like the methods of QrCode with the same names.
+	public: bool getModule(int x, int y) const;
+	public: int getPackedLineBytes(int border) const;
+	public: void getRowBits(int x, int y, int count, std::uint8_t *out) const;
+	public: void getPackedRows(int border, std::uint8_t *out, std::size_t stride) const;
+	
+	
+	/*---- Instance fields ----*/
+	
+	private: int version;
+	private: int size;
+	private: QrCode::Ecc errorCorrectionLevel;
+	private: int mask;
+	private: std::uint32_t payloadHash;
+	
+	// Packed rows in the archive
+	private: const std::uint8_t *bits;
+	private: std::size_t rowBytes;
+	
+};
+
+
+
+/* 
+ * Reads a packed archive written by ArchiveWriter from memory, e.g. a file mapped with mmap()
+ * or loaded at once. The header and index are checked when needed, the symbols are not parsed:
+ * getSymbol() finds the entry of symbol n directly and returns a view of its data.
+ */
+class ArchiveReader {
+	
+	/*---- Constructor ----*/
+	
+	// Reads the header of the archive of the given length. Throws std::invalid_argument if it is not an archive.
+	public: ArchiveReader(const std::uint8_t *data, std::size_t length);
+	
+	
+	/*---- Methods ----*/
+	
+	// Returns the number of symbols.
+	public: unsigned long getCount() const;
+	
+	// Returns a view of symbol n. Throws std::out_of_range if n is out of range and
+	// std::invalid_argument if its entry does not describe data inside the archive.
+	public: SymbolView getSymbol(unsigned long n) const;
+	
+	
+	/*---- Instance fields ----*/
+	
+	private: const std::uint8_t *data;
+	private: std::size_t length;
+	private: unsigned long count;
+	
+};
+
+
+
+/* 
+ * Selects the implementations of the encoder's hot kernels by the instruction set extensions of the
+ * CPU, so one binary uses the best code on every machine. The CPU is examined once, on first use, and
+ * each kernel is bound to a function pointer for the highest level that it has an implementation for.
+ * The first use may come from several threads at once, the examination is guarded to run only once
+ * and the kernel pointers are published atomically.
+ * For testing, a lower level can be forced with setLevel() or the environment variable QRCODEGEN_CPU_LEVEL
+ * (scalar, sse2, ssse3, avx2 or avx512bw), read at the same time. Only x86 builds with GCC or Clang have
+ * SIMD kernels; elsewhere, e.g. on DOS, the supported level is always SCALAR.
+ */
+class CpuDispatch {
+	
+	/*---- Public helper enumeration ----*/
+	
+	// Instruction set levels, each includes the ones before.
+	public: enum Level {
+		SCALAR, SSE2, SSSE3, AVX2, AVX512BW
+	};
+	
+	
+	/*---- Public static functions ----*/
+	
+	// Returns the highest level supported by the CPU.
+	public: static Level getSupportedLevel();
+	
+	// Returns the level that kernels are selected for: the supported level, or the forced one.
+	public: static Level getLevel();
+	
+	// Forces kernels for the given level and rebinds them. Levels above the supported one are lowered to it.
+	// Not safe to call while other threads encode or call setLevel(), use it before encoding starts.
+	public: static void setLevel(Level level);
+	
+	// Returns the lowercase name of the given level, as used by QRCODEGEN_CPU_LEVEL.
+	public: static const char *getLevelName(Level level);
+	
+	// Returns the name of the level of the kernels that are bound, which may be lower than getLevel()
+	// where a kernel has no implementation for it (e.g. "avx2" on an AVX-512 CPU).
+	public: static const char *getKernelName();
+	
+	
+	// (Package-private) Kernel that computes the interleaved Reed-Solomon remainders of all blocks.
+	public: typedef void (*ReedSolomonKernel)(const std::uint8_t *data, int numBlocks, int numShortBlocks,
+		int shortDataLen, const std::uint8_t *divisor, int degree, std::uint8_t *ecc);
+	
+	// (Package-private) Returns the bound Reed-Solomon kernel, see QrCode::reedSolomonComputeRemainders().
+	public: static ReedSolomonKernel getReedSolomonKernel();
+	
+	
+	/*---- Private helper functions ----*/
+	
+	// Examines the CPU and binds the kernels, if not done yet.
+	private: static void initialize();
+	
+	// Examines the CPU and the environment and binds the kernels. Returns true, for the once-guard.
+	private: static bool detectLevel();
+	
+	// Binds the kernels for the current level.
+	private: static void bindKernels();
+	
+	
+	/*---- Static fields ----*/
+	
+	private: static Level supportedLevel;
+	private: static Level level;
+	
+	// The bound kernels and the level of their implementation
+	private: static ReedSolomonKernel reedSolomonKernel;
+	private: static Level kernelLevel;
+	
 };
 
 
@@ -553,6 +1205,129 @@ class BitBuffer : public std::vector<bool> {
 	
 };
 
+
+
+/* 
+ * Counts the heap allocations made while encoding, separately for each stage of the encoder.
+ * Accounting is opt-in: build with QRCODEGEN_COUNT_ALLOCATIONS defined, which replaces the global
+ * operator new and delete, and keep a tracker alive around the encode calls to be measured. While a
+ * tracker exists it is the active one; trackers can be nested, the innermost one records. Without
+ * QRCODEGEN_COUNT_ALLOCATIONS all counters stay zero. Not thread-safe.
+ */
+class AllocationTracker {
+	
+	/*---- Public helper types ----*/
+	
+	/* 
+	 * The stages of the encoder. OTHER counts allocations outside of the encoder,
+	 * e.g. copies of the resulting QrCode object.
+	 */
+	public: enum Stage {
+		OTHER = 0,  // Outside of the encoder
+		SEGMENTS ,  // Building segments from the text
+		CODEWORDS,  // Concatenating segments and packing the data codewords
+		ECC      ,  // Computing error correction codewords and interleaving
+		MODULES  ,  // Allocating the grids, drawing function patterns and codewords
+		MASKING  ,  // Choosing and applying the mask
+		NUM_STAGES
+	};
+	
+	
+	/* 
+	 * Counters of one stage. The peak is the high-water mark of all bytes allocated since the
+	 * tracker was created and not yet freed, observed while the stage was running.
+	 */
+	public: struct Stats {
+		long allocations;
+		long bytes;
+		long peakBytes;
+	};
+	
+	
+	/*---- Constructor and destructor ----*/
+	
+	// Creates a tracker with all counters zero and makes it the active one.
+	public: AllocationTracker();
+	
+	// Makes the previously active tracker active again.
+	public: ~AllocationTracker();
+	
+	
+	/*---- Methods ----*/
+	
+	// Returns the counters of the given stage.
+	public: const Stats &getStats(Stage stage) const;
+	
+	// Returns the sums of all stages, with the highest peak of all stages.
+	public: Stats getTotal() const;
+	
+	// Returns the number of bytes allocated since the tracker was created and not yet freed.
+	public: long getCurrentBytes() const;
+	
+	// Returns the stage that allocations are charged to now, OTHER outside of the encoder.
+	public: Stage getStage() const;
+	
+	
+	// (Package-private) Marks the start of the given stage for the active tracker, if any.
+	public: static void enterStage(Stage stage);
+	
+	
+	/* 
+	 * (Package-private) Enters a stage for its lifetime. The destructor gives the active tracker back the
+	 * stage it had before, also when the encoder returns early or throws, so that later allocations
+	 * are not charged to a stage of an encode that has ended.
+	 */
+	public: class StageGuard {
+		
+		public: explicit StageGuard(Stage stage);
+		
+		public: ~StageGuard();
+		
+		// The tracker that was active on construction, or NULL, and its stage at that time
+		private: AllocationTracker *tracker;
+		private: Stage previous;
+		
+		// Not copyable
+		private: StageGuard(const StageGuard &);
+		private: StageGuard &operator=(const StageGuard &);
+		
+	};
+	
+	friend class StageGuard;
+	
+	// (Package-private) Records an allocation of the given size with the active tracker. Returns the serial
+	// number of that tracker, which has to be passed to recordFree(), or 0 if no tracker is active.
+	public: static long recordAllocation(std::size_t size);
+	
+	// (Package-private) Records that an allocation of the given size, counted by the tracker with the given
+	// serial number, was freed. Nothing is recorded if that tracker no longer exists.
+	public: static void recordFree(long serial, std::size_t size);
+	
+	
+	/*---- Instance fields ----*/
+	
+	private: Stats stats[NUM_STAGES];
+	private: long currentBytes;
+	private: Stage stage;
+	private: AllocationTracker *previous;
+	
+	// Unique number of this tracker, so that a later tracker at the same address is not mistaken for it
+	private: long serial;
+	
+	// The innermost tracker, or NULL.
+	private: static AllocationTracker *active;
+	
+	// Serial number of the last tracker created.
+	private: static long lastSerial;
+	
+	
+	/*---- Not copyable ----*/
+	
+	private: AllocationTracker(const AllocationTracker &);
+	private: AllocationTracker &operator=(const AllocationTracker &);
+	
+};
+
 }
 
 #endif  // QRCODEGEN_HPP
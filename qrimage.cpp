@@ -0,0 +1,558 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrimage.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using qrcodegen::QrCode;
+
+namespace qrimage {
+// Border size in QR modules for PBM images
+static const int PBM_BORDER = 4;
+
+// Function to format the PBM header for an image of width * height pixels
+void formatPbmHeader(int width, int height, char* header) {
+    std::sprintf(header, "P4\n%d %d\n", width, height);
+}
+
+// Function to get the size in bytes of the PBM image written by writePbm
+unsigned long getPbmSize(const QrCode& qr) {
+    const int qrSize = qr.getSize() + 2 * PBM_BORDER;
+
+    char header[32];
+    formatPbmHeader(qrSize, qrSize, header);
+    return std::strlen(header) + static_cast<unsigned long>((qrSize + 7) / 8) * qrSize;
+}
+
+// Function to write a QR code as binary PBM (P4) image
+void writePbm(const QrCode& qr, FILE* output) {
+    const int border = PBM_BORDER;                 // Border size in QR modules
+    const int qrSize = qr.getSize() + 2 * border;  // QR code size including border (in modules)
+
+    char header[32];
+    formatPbmHeader(qrSize, qrSize, header);
+    std::fputs(header, output);
+
+    // Rows are packed 8 pixels per byte, MSB first, 1 is black
+    std::vector<uint8_t> row(qr.getPackedLineBytes(border));
+    for (int y = -border; y < qr.getSize() + border; y++) {
+        qr.getRowBits(-border, y, qrSize, &row[0]);
+        if (std::fwrite(&row[0], 1, row.size(), output) != row.size()) {
+            throw std::runtime_error("Error writing the output file.");
+        }
+    }
+}
+
+// Border size in QR modules for vector images
+static const int VECTOR_BORDER = 4;
+
+// Vector formats written by writeShapes
+enum VectorFormat { SVG_PATH, PDF_CONTENT };
+
+// Helper function to write text, or only count it if output is NULL. Returns the length.
+static unsigned long writeText(const char* text, FILE* output) {
+    if (output && std::fputs(text, output) == EOF) {
+        throw std::runtime_error("Error writing the output file.");
+    }
+    return std::strlen(text);
+}
+
+// Helper function to get the color of module x of a packed row
+static bool isDark(const uint8_t* row, int x) {
+    return (row[x >> 3] & (0x80 >> (x & 7))) != 0;
+}
+
+// Helper function to check if columns x0 to x1 - 1 of a packed row are exactly one whole run of
+// dark modules, i.e. dark with a light or missing module on each side
+static bool hasRun(const uint8_t* row, int size, int x0, int x1) {
+    if ((x0 > 0 && isDark(row, x0 - 1)) || (x1 < size && isDark(row, x1))) {
+        return false;
+    }
+    for (int x = x0; x < x1; x++) {
+        if (!isDark(row, x)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Helper function to write the dark modules of a QR code as rectangles in the given format in a
+// single pass over the rows, or only count the bytes if output is NULL. Returns the length.
+static unsigned long writeShapes(const QrCode& qr, bool rectangles, VectorFormat format, FILE* output) {
+    const int size = qr.getSize();
+    const int fullSize = size + 2 * VECTOR_BORDER;
+    const size_t stride = static_cast<size_t>(qr.getPackedLineBytes(0));
+    unsigned long length = 0;
+    char text[48];
+
+    // The runs of later rows are needed to merge rectangles, so all rows are packed first
+    std::vector<uint8_t> rows(stride * size);
+    qr.getPackedRows(0, &rows[0], stride);
+
+    // Start of the last rectangle, SVG moves are relative to it because "z" returns there
+    int lastX = 0;
+    int lastY = 0;
+    for (int y = 0; y < size; y++) {
+        const uint8_t* row = &rows[stride * y];
+        int x1 = 0;
+        while (x1 < size) {
+            // Find the next run of dark modules
+            int x0 = x1;
+            while (x0 < size && !isDark(row, x0)) {
+                x0++;
+            }
+            if (x0 == size) {
+                break;
+            }
+            x1 = x0;
+            while (x1 < size && isDark(row, x1)) {
+                x1++;
+            }
+
+            // With rectangles, an equal run in the row above is part of an earlier rectangle
+            int height = 1;
+            if (rectangles) {
+                if (y > 0 && hasRun(row - stride, size, x0, x1)) {
+                    continue;
+                }
+                while (y + height < size && hasRun(row + stride * height, size, x0, x1)) {
+                    height++;
+                }
+            }
+
+            int left = x0 + VECTOR_BORDER;
+            int top = y + VECTOR_BORDER;
+            int width = x1 - x0;
+            if (format == SVG_PATH) {
+                int dx = left - lastX;
+                int dy = top - lastY;
+                std::sprintf(text, "m%d%s%dh%dv%dh-%dz", dx, dy < 0 ? "" : " ", dy, width, height, width);
+                lastX = left;
+                lastY = top;
+            } else {
+                std::sprintf(text, "%d %d %d %d re\n", left, fullSize - top - height, width, height);
+            }
+            length += writeText(text, output);
+        }
+    }
+    return length;
+}
+
+// Helper function to write the SVG image, or only count it if output is NULL. Returns the length.
+static unsigned long writeSvgImage(const QrCode& qr, bool rectangles, FILE* output) {
+    const int fullSize = qr.getSize() + 2 * VECTOR_BORDER;
+    unsigned long length = 0;
+    char text[256];
+
+    std::sprintf(text,
+                 "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                 "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" viewBox=\"0 0 %d %d\" "
+                 "shape-rendering=\"crispEdges\">\n"
+                 "<rect width=\"100%%\" height=\"100%%\" fill=\"#FFFFFF\"/>\n"
+                 "<path d=\"",
+                 fullSize, fullSize);
+    length += writeText(text, output);
+    length += writeShapes(qr, rectangles, SVG_PATH, output);
+    length += writeText("\" fill=\"#000000\"/>\n</svg>\n", output);
+    return length;
+}
+
+// Helper function to write the PDF content stream, or only count it if output is NULL. Returns the length.
+static unsigned long writePdfStream(const QrCode& qr, bool rectangles, FILE* output) {
+    const int fullSize = qr.getSize() + 2 * VECTOR_BORDER;
+    unsigned long length = 0;
+    char text[64];
+
+    // White background, then all dark rectangles filled at once
+    std::sprintf(text, "1 g\n0 0 %d %d re\nf\n0 g\n", fullSize, fullSize);
+    length += writeText(text, output);
+    length += writeShapes(qr, rectangles, PDF_CONTENT, output);
+    length += writeText("f\n", output);
+    return length;
+}
+
+// Function to write a QR code as SVG image with a single path
+void writeSvg(const QrCode& qr, FILE* output, bool rectangles) {
+    writeSvgImage(qr, rectangles, output);
+}
+
+// Function to get the size in bytes of the SVG image written by writeSvg
+unsigned long getSvgSize(const QrCode& qr, bool rectangles) {
+    return writeSvgImage(qr, rectangles, NULL);
+}
+
+// Function to write a QR code as PDF content stream
+void writePdfContent(const QrCode& qr, FILE* output, bool rectangles) {
+    writePdfStream(qr, rectangles, output);
+}
+
+// Function to get the size in bytes of the PDF content stream written by writePdfContent
+unsigned long getPdfContentSize(const QrCode& qr, bool rectangles) {
+    return writePdfStream(qr, rectangles, NULL);
+}
+
+// PNG file signature
+static const uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+// Filter types of PNG rows
+static const uint8_t FILTER_NONE = 0;
+static const uint8_t FILTER_UP = 2;
+
+// Largest copy of deflate
+static const int MAX_COPY = 258;
+
+// Deflate base values and extra bits of the length codes 257 to 285 and the distance codes 0 to 29
+static const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                         31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t DISTANCE_BASE[30] = {1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+                                           193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                           6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// CRC-32 of each 4 bit value, the CRC is updated one nibble at a time to keep the table small
+static const uint32_t CRC_TABLE[16] = {0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+                                       0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+                                       0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+                                       0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL};
+
+// Helper function to continue a CRC-32 with the given bytes
+static uint32_t updateCrc(uint32_t crc, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ CRC_TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC_TABLE[crc & 0x0F];
+    }
+    return crc;
+}
+
+// Helper function to store a 32 bit value big endian
+static void putBigEndian(uint32_t value, uint8_t* out) {
+    out[0] = static_cast<uint8_t>(value >> 24);
+    out[1] = static_cast<uint8_t>(value >> 16);
+    out[2] = static_cast<uint8_t>(value >> 8);
+    out[3] = static_cast<uint8_t>(value);
+}
+
+// Helper function to reverse the order of the lowest count bits, Huffman codes are stored MSB first
+static unsigned int reverseBits(unsigned int bits, int count) {
+    unsigned int result = 0;
+    for (int i = 0; i < count; i++) {
+        result = (result << 1) | ((bits >> i) & 1);
+    }
+    return result;
+}
+
+// Constructor: Write the signature, the header and the start of the image data
+PngWriter::PngWriter(FILE* output, int width, int height, Level level)
+    : output(output),
+      level(level),
+      rowBytes((static_cast<size_t>(width) + 7) / 8),
+      rowsLeft(height),
+      hasPreviousRow(false),
+      bitBuffer(0),
+      bitCount(0),
+      adlerA(1),
+      adlerB(0),
+      length(0) {
+    // Rows must fit into a stored block and copies from the previous row must reach back
+    if (width < 1 || height < 1 || rowBytes > 32767) {
+        throw std::invalid_argument("Invalid PNG image size");
+    }
+    line.resize(rowBytes + 1);
+    previousLine.resize(rowBytes + 1);
+    previousRow.resize(rowBytes);
+    chunk.reserve(MAX_CHUNK + 8);
+
+    write(PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+
+    // 1 bit grayscale, deflate, adaptive filtering, no interlace
+    uint8_t header[13];
+    putBigEndian(static_cast<uint32_t>(width), header);
+    putBigEndian(static_cast<uint32_t>(height), header + 4);
+    header[8] = 1;
+    header[9] = 0;
+    header[10] = 0;
+    header[11] = 0;
+    header[12] = 0;
+    writeChunk("IHDR", header, sizeof(header));
+
+    // zlib header for deflate with a 32 KB window
+    chunk.push_back(0x78);
+    chunk.push_back(0x01);
+    if (level != STORED) {
+        // One block with the fixed Huffman codes for all rows, not the last block
+        putBits(0, 1);
+        putBits(1, 2);
+    }
+}
+
+// Method to add the next row of pixels
+void PngWriter::writeRow(const uint8_t* pixels) {
+    if (rowsLeft <= 0) {
+        throw std::logic_error("Too many PNG rows");
+    }
+
+    // A repeated row is all zeros with the up filter, PNG uses 0 for black so the others are inverted
+    bool firstLine = !hasPreviousRow;
+    bool repeated = hasPreviousRow && std::memcmp(pixels, &previousRow[0], rowBytes) == 0;
+    line.swap(previousLine);
+    if (repeated) {
+        line[0] = FILTER_UP;
+        std::memset(&line[1], 0, rowBytes);
+    } else {
+        line[0] = FILTER_NONE;
+        for (size_t i = 0; i < rowBytes; i++) {
+            line[i + 1] = static_cast<uint8_t>(~pixels[i]);
+        }
+        std::memcpy(&previousRow[0], pixels, rowBytes);
+    }
+    hasPreviousRow = true;
+    rowsLeft--;
+
+    // Adler-32 of the image data, the sums stay far below the 32 bit limit for one row
+    for (size_t i = 0; i < line.size(); i++) {
+        adlerA += line[i];
+        adlerB += adlerA;
+        if ((i & 0x0FFF) == 0x0FFF) {
+            adlerA %= 65521UL;
+            adlerB %= 65521UL;
+        }
+    }
+    adlerA %= 65521UL;
+    adlerB %= 65521UL;
+
+    compressLine(firstLine);
+}
+
+// Method to end the image after the last row was added
+void PngWriter::finish() {
+    if (rowsLeft != 0) {
+        throw std::logic_error("Missing PNG rows");
+    }
+    if (level != STORED) {
+        putBits(0, 7);  // End of the block
+    }
+
+    // Empty last block, then the Adler-32 checksum on a byte boundary
+    putBits(1, 1);
+    putBits(1, 2);
+    putBits(0, 7);
+    alignToByte();
+    uint8_t adler[4];
+    putBigEndian(static_cast<uint32_t>((adlerB << 16) | adlerA), adler);
+    for (int i = 0; i < 4; i++) {
+        putBits(adler[i], 8);
+    }
+
+    flushChunk();
+    writeChunk("IEND", NULL, 0);
+}
+
+// Method to get the number of bytes written so far
+unsigned long PngWriter::getLength() const {
+    return length;
+}
+
+// Helper method to compress the filtered row in line
+void PngWriter::compressLine(bool firstLine) {
+    const int size = static_cast<int>(line.size());
+
+    if (level == STORED) {
+        // Stored block of the row, not the last block
+        putBits(0, 3);
+        alignToByte();
+        putBits(static_cast<unsigned long>(size) & 0xFF, 8);
+        putBits(static_cast<unsigned long>(size) >> 8, 8);
+        putBits(~static_cast<unsigned long>(size) & 0xFF, 8);
+        putBits((~static_cast<unsigned long>(size) >> 8) & 0xFF, 8);
+        for (int i = 0; i < size; i++) {
+            putBits(line[i], 8);
+        }
+        return;
+    }
+
+    for (int i = 0; i < size;) {
+        int limit = size - i < MAX_COPY ? size - i : MAX_COPY;
+
+        // Run of the byte before, at the start of the line that is the last byte of the previous line
+        int runLength = 0;
+        if (i > 0 || !firstLine) {
+            uint8_t before = i > 0 ? line[i - 1] : previousLine[size - 1];
+            while (runLength < limit && line[i + runLength] == before) {
+                runLength++;
+            }
+        }
+
+        // Bytes equal to the previous line
+        int lineLength = 0;
+        if (level == SMALL && !firstLine) {
+            while (lineLength < limit && line[i + lineLength] == previousLine[i + lineLength]) {
+                lineLength++;
+            }
+        }
+
+        if (lineLength > runLength && lineLength >= 3) {
+            putCopy(lineLength, size);
+            i += lineLength;
+        } else if (runLength >= 3) {
+            putCopy(runLength, 1);
+            i += runLength;
+        } else {
+            putLiteral(line[i]);
+            i++;
+        }
+    }
+}
+
+// Helper method to append bits to the compressed data
+void PngWriter::putBits(unsigned long bits, int count) {
+    bitBuffer |= bits << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+        chunk.push_back(static_cast<uint8_t>(bitBuffer));
+        bitBuffer >>= 8;
+        bitCount -= 8;
+        if (chunk.size() >= MAX_CHUNK) {
+            flushChunk();
+        }
+    }
+}
+
+// Helper method to append a literal byte with the fixed Huffman codes
+void PngWriter::putLiteral(int value) {
+    if (value < 144) {
+        putBits(reverseBits(0x30 + value, 8), 8);
+    } else {
+        putBits(reverseBits(0x190 + value - 144, 9), 9);
+    }
+}
+
+// Helper method to append a copy with the fixed Huffman codes
+void PngWriter::putCopy(int length, int distance) {
+    int code = 28;
+    while (LENGTH_BASE[code] > length) {
+        code--;
+    }
+    int symbol = 257 + code;
+    if (symbol < 280) {
+        putBits(reverseBits(symbol - 256, 7), 7);
+    } else {
+        putBits(reverseBits(0xC0 + symbol - 280, 8), 8);
+    }
+    putBits(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+    code = 29;
+    while (DISTANCE_BASE[code] > distance) {
+        code--;
+    }
+    putBits(reverseBits(code, 5), 5);
+    putBits(distance - DISTANCE_BASE[code], DISTANCE_EXTRA[code]);
+}
+
+// Helper method to fill the last byte of the compressed data with 0 bits
+void PngWriter::alignToByte() {
+    if (bitCount > 0) {
+        putBits(0, 8 - bitCount);
+    }
+}
+
+// Helper method to write the compressed data as IDAT chunk
+void PngWriter::flushChunk() {
+    if (!chunk.empty()) {
+        writeChunk("IDAT", &chunk[0], chunk.size());
+        chunk.clear();
+    }
+}
+
+// Helper method to write a chunk with its length and CRC
+void PngWriter::writeChunk(const char* type, const uint8_t* data, size_t size) {
+    uint8_t header[8];
+    putBigEndian(static_cast<uint32_t>(size), header);
+    std::memcpy(header + 4, type, 4);
+    write(header, sizeof(header));
+    write(data, size);
+
+    uint8_t crc[4];
+    putBigEndian(updateCrc(updateCrc(0xFFFFFFFFUL, header + 4, 4), data, size) ^ 0xFFFFFFFFUL, crc);
+    write(crc, sizeof(crc));
+}
+
+// Helper method to write or count bytes
+void PngWriter::write(const void* data, size_t size) {
+    if (output && size > 0 && std::fwrite(data, 1, size, output) != size) {
+        throw std::runtime_error("Error writing the output file.");
+    }
+    length += size;
+}
+
+// Border size in QR modules for PNG images
+static const int PNG_BORDER = 4;
+
+// Helper function to write the PNG image, or only count it if output is NULL. Returns the length.
+static unsigned long writePngImage(const QrCode& qr, int scale, PngWriter::Level level, FILE* output) {
+    if (scale < 1 || scale > 64) {
+        throw std::invalid_argument("Invalid PNG scale");
+    }
+    const int border = PNG_BORDER;                 // Border size in QR modules
+    const int qrSize = qr.getSize() + 2 * border;  // QR code size including border (in modules)
+    const int width = qrSize * scale;              // Image size in pixels
+
+    PngWriter png(output, width, width, level);
+    std::vector<uint8_t> modules(qr.getPackedLineBytes(border));
+    std::vector<uint8_t> pixels((width + 7) / 8);
+    for (int y = -border; y < qr.getSize() + border; y++) {
+        // Scale the row of modules horizontally, then repeat it vertically
+        qr.getRowBits(-border, y, qrSize, &modules[0]);
+        std::fill(pixels.begin(), pixels.end(), 0);
+        for (int x = 0; x < qrSize; x++) {
+            if (modules[x >> 3] & (0x80 >> (x & 7))) {
+                for (int p = x * scale; p < (x + 1) * scale; p++) {
+                    pixels[p >> 3] |= static_cast<uint8_t>(0x80 >> (p & 7));
+                }
+            }
+        }
+        for (int i = 0; i < scale; i++) {
+            png.writeRow(&pixels[0]);
+        }
+    }
+    png.finish();
+    return png.getLength();
+}
+
+// Function to write a QR code as 1-bit grayscale PNG image
+void writePng(const QrCode& qr, FILE* output, int scale, PngWriter::Level level) {
+    writePngImage(qr, scale, level, output);
+}
+
+// Function to get the size in bytes of the PNG image written by writePng
+unsigned long getPngSize(const QrCode& qr, int scale, PngWriter::Level level) {
+    return writePngImage(qr, scale, level, NULL);
+}
+}  // namespace qrimage
@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRIMAGE_HPP
+#define QRIMAGE_HPP
+
+#include <cstdio>
+#include <vector>
+
+#include "qrcodegen.hpp"
+
+namespace qrimage {
+
+/*
+ * This class writes a 1-bit grayscale PNG image row by row without holding the image in memory.
+ * Rows that repeat the previous one, as in scaled QR codes, use the "up" filter and become runs of
+ * zero bytes. The image data is compressed with a small built-in deflate: STORED only frames the
+ * rows, FAST codes runs of equal bytes with the fixed Huffman codes, SMALL also copies bytes from
+ * the previous row. IDAT chunks are written as they fill up, their CRC and the Adler-32 checksum of
+ * the image data are computed along the way.
+ */
+class PngWriter {
+   public:
+    // Compression levels, from the fastest to the smallest output
+    enum Level { STORED, FAST, SMALL };
+
+    // Constructor to start an image of width * height pixels, writes the header. If output is NULL
+    // nothing is written, only the length of the image is counted.
+    PngWriter(FILE* output, int width, int height, Level level = FAST);
+
+    // Method to add the next row of pixels, packed 8 pixels per byte, MSB first, 1 is black
+    void writeRow(const uint8_t* pixels);
+
+    // Method to end the image after the last row was added
+    void finish();
+
+    // Method to get the number of bytes written so far
+    unsigned long getLength() const;
+
+   private:
+    // Output file, NULL to count only
+    FILE* output;
+
+    // Compression level
+    Level level;
+
+    // Bytes of a packed row and rows still to come
+    size_t rowBytes;
+    int rowsLeft;
+
+    // Filtered current and previous row, each starting with the filter type byte, and the previous
+    // unfiltered row
+    std::vector<uint8_t> line;
+    std::vector<uint8_t> previousLine;
+    std::vector<uint8_t> previousRow;
+    bool hasPreviousRow;
+
+    // Compressed data waiting for the next IDAT chunk, and bits waiting for the next byte
+    std::vector<uint8_t> chunk;
+    unsigned long bitBuffer;
+    int bitCount;
+
+    // Adler-32 sums of the image data
+    unsigned long adlerA;
+    unsigned long adlerB;
+
+    // Number of bytes written
+    unsigned long length;
+
+    // Maximum size of the data of an IDAT chunk
+    static const size_t MAX_CHUNK = 4096;
+
+    // Helper method to compress the filtered row in line, copies can not reach back before the first line
+    void compressLine(bool firstLine);
+
+    // Helper method to append the given number of bits to the compressed data, LSB first
+    void putBits(unsigned long bits, int count);
+
+    // Helper method to append a literal byte or a copy of length bytes from distance bytes back
+    // with the fixed Huffman codes
+    void putLiteral(int value);
+    void putCopy(int length, int distance);
+
+    // Helper method to fill the last byte of the compressed data with 0 bits
+    void alignToByte();
+
+    // Helper method to write the compressed data as IDAT chunk
+    void flushChunk();
+
+    // Helper method to write a chunk with its length and CRC
+    void writeChunk(const char* type, const uint8_t* data, size_t size);
+
+    // Helper method to write or count bytes
+    void write(const void* data, size_t size);
+};
+
+// Function to format the header of a binary PBM (P4) image of width * height pixels into the given
+// buffer, which must hold at least 32 characters
+void formatPbmHeader(int width, int height, char* header);
+
+// Function to write a QR code including a border of 4 modules as binary PBM (P4) image,
+// PBM images can be concatenated in one file
+void writePbm(const qrcodegen::QrCode& qr, FILE* output);
+
+// Function to get the size in bytes of the PBM image written by writePbm
+unsigned long getPbmSize(const qrcodegen::QrCode& qr);
+
+// Function to write a QR code including a border of 4 modules as SVG image with a single path,
+// one unit per module. Each horizontal run of dark modules becomes one rectangle, with rectangles
+// equal runs of the following rows are merged too. The path uses relative moves only.
+void writeSvg(const qrcodegen::QrCode& qr, FILE* output, bool rectangles = true);
+
+// Function to get the size in bytes of the SVG image written by writeSvg
+unsigned long getSvgSize(const qrcodegen::QrCode& qr, bool rectangles = true);
+
+// Function to write a QR code including a border of 4 modules as PDF content stream that fills
+// the same rectangles as writeSvg, one unit per module with the origin at the bottom left corner
+void writePdfContent(const qrcodegen::QrCode& qr, FILE* output, bool rectangles = true);
+
+// Function to get the size in bytes of the PDF content stream written by writePdfContent
+unsigned long getPdfContentSize(const qrcodegen::QrCode& qr, bool rectangles = true);
+
+// Function to write a QR code including a border of 4 modules as 1-bit grayscale PNG image with
+// scale * scale pixels per module, scale must be 1 to 64
+void writePng(const qrcodegen::QrCode& qr, FILE* output, int scale = 8, PngWriter::Level level = PngWriter::FAST);
+
+// Function to get the size in bytes of the PNG image written by writePng
+unsigned long getPngSize(const qrcodegen::QrCode& qr, int scale = 8, PngWriter::Level level = PngWriter::FAST);
+}  // namespace qrimage
+
+#endif  // QRIMAGE_HPP
@@ -0,0 +1,260 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrserv.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "qrcodegen.hpp"
+#include "qrimage.hpp"
+#include "qrtext.hpp"
+
+using qrcodegen::QrCode;
+using qrcodegen::QrSegment;
+
+namespace qrserv {
+// Constructor: Set the converter, create the scratch file and clear the metrics
+EncodeService::EncodeService(const charconv::CharConverter& converter)
+    : converter(converter),
+      scratch(std::tmpfile()),
+      requests(0),
+      failures(0),
+      bytesIn(0),
+      bytesOut(0),
+      totalMillis(0),
+      maxMillis(0) {
+    if (!scratch) {
+        throw std::runtime_error("Error creating a temporary file.");
+    }
+    started = std::clock();
+}
+
+// Destructor: Close the scratch file, which removes it
+EncodeService::~EncodeService() {
+    std::fclose(scratch);
+}
+
+// Method to serve requests from input until QUIT or the end of the input
+void EncodeService::run(FILE* input, FILE* output) {
+    char line[MAX_LINE];
+
+    while (std::fgets(line, sizeof(line), input)) {
+        size_t length = std::strlen(line);
+        if (length == 0 || line[length - 1] != '\n') {
+            // Header line too long, drop the rest of it
+            int ch;
+            while ((ch = std::fgetc(input)) != EOF && ch != '\n') {
+            }
+            writeError("Request line too long", output);
+            requests++;
+            failures++;
+            continue;
+        }
+
+        // Strip the line break
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) {
+            line[--length] = '\0';
+        }
+
+        if (std::strncmp(line, "ENCODE ", 7) == 0) {
+            handleEncode(line + 7, input, output);
+        } else if (std::strcmp(line, "STATS") == 0) {
+            handleStats(output);
+        } else if (std::strcmp(line, "QUIT") == 0) {
+            std::fputs("OK 0\n", output);
+            std::fflush(output);
+            break;
+        } else if (length > 0) {
+            writeError("Unknown request", output);
+            requests++;
+            failures++;
+        }
+    }
+}
+
+// Helper method to handle an ENCODE request
+void EncodeService::handleEncode(const char* args, FILE* input, FILE* output) {
+    char eccName = 0;
+    int minVersion = 0;
+    int maxVersion = 0;
+    int mask = 0;
+    char format[8];
+    unsigned long length = 0;
+
+    if (std::sscanf(args, " %c %d %d %d %7s %lu", &eccName, &minVersion, &maxVersion, &mask, format, &length) != 6) {
+        writeError("Malformed ENCODE request", output);
+        requests++;
+        failures++;
+        return;
+    }
+
+    // Read the payload, an oversized one is skipped to keep the stream in sync
+    std::string payload;
+    if (length <= MAX_PAYLOAD) {
+        payload.resize(length);
+        if (length > 0 && std::fread(&payload[0], 1, length, input) != length) {
+            writeError("Truncated payload", output);
+            requests++;
+            failures++;
+            return;
+        }
+    } else {
+        for (unsigned long i = 0; i < length; i++) {
+            if (std::fgetc(input) == EOF) {
+                break;
+            }
+        }
+    }
+    bytesIn += length;
+    requests++;
+
+    std::clock_t start = std::clock();
+    bool headerSent = false;
+    try {
+        if (length > MAX_PAYLOAD) {
+            throw std::length_error("Payload too long");
+        }
+        bool svg = std::strcmp(format, "SVG") == 0;
+        bool png = std::strcmp(format, "PNG") == 0;
+        if (!svg && !png && std::strcmp(format, "PBM") != 0) {
+            throw std::invalid_argument("Unsupported output format");
+        }
+        // The payload is encoded as C string, so a NUL character would cut it short
+        if (payload.find('\0') != std::string::npos) {
+            throw std::invalid_argument("Payload contains NUL characters");
+        }
+
+        QrCode::Ecc ecl;
+        switch (eccName) {
+            case 'L':
+                ecl = QrCode::LOW;
+                break;
+            case 'M':
+                ecl = QrCode::MEDIUM;
+                break;
+            case 'Q':
+                ecl = QrCode::QUARTILE;
+                break;
+            case 'H':
+                ecl = QrCode::HIGH;
+                break;
+            default:
+                throw std::invalid_argument("Unknown error correction level");
+        }
+
+        // Payloads that do not fit are answered without an exception, they can be frequent
+        const std::vector<QrSegment> segs = qrtext::makeSegments(payload.c_str(), converter);
+        QrCode qr;
+        QrCode::Capacity capacity;
+        QrCode::Status status = QrCode::tryEncodeSegments(segs, ecl, qr, capacity, minVersion, maxVersion, mask);
+        if (status == QrCode::SUCCESS) {
+            // Render the image once, the reply header needs its length
+            std::rewind(scratch);
+            if (svg) {
+                qrimage::writeSvg(qr, scratch);
+            } else if (png) {
+                qrimage::writePng(qr, scratch);
+            } else {
+                qrimage::writePbm(qr, scratch);
+            }
+            long size = std::ftell(scratch);
+            if (size < 0) {
+                throw std::runtime_error("Error writing the temporary file.");
+            }
+
+            std::fprintf(output, "OK %d %c %d %lu\n", qr.getVersion(), "LMQH"[qr.getErrorCorrectionLevel()],
+                         qr.getMask(), static_cast<unsigned long>(size));
+            headerSent = true;
+            copyScratch(static_cast<unsigned long>(size), output);
+            std::fflush(output);
+            bytesOut += static_cast<unsigned long>(size);
+        } else {
+            writeError(QrCode::getStatusMessage(status, capacity).c_str(), output);
+            failures++;
+        }
+    } catch (const std::exception& e) {
+        // The OK header announced the image length, a reply cut short would desync the stream
+        if (headerSent) {
+            throw;
+        }
+
+        // Covers the invalid requests and running out of memory, the service keeps running
+        writeError(e.what(), output);
+        failures++;
+    }
+
+    unsigned long millis = toMillis(std::clock() - start);
+    totalMillis += millis;
+    if (millis > maxMillis) {
+        maxMillis = millis;
+    }
+}
+
+// Helper method to answer a STATS request
+void EncodeService::handleStats(FILE* output) const {
+    unsigned long uptime = toMillis(std::clock() - started);
+    char text[256];
+
+    std::sprintf(text,
+                 "requests %lu\nfailures %lu\nbytes_in %lu\nbytes_out %lu\nlatency_avg_ms %lu\nlatency_max_ms %lu\n"
+                 "requests_per_min %lu\ncpu_kernels %s\n",
+                 requests, failures, bytesIn, bytesOut, requests ? totalMillis / requests : 0UL, maxMillis,
+                 uptime ? static_cast<unsigned long>(requests * 60000.0 / uptime) : 0UL,
+                 qrcodegen::CpuDispatch::getKernelName());
+
+    std::fprintf(output, "OK %lu\n%s", static_cast<unsigned long>(std::strlen(text)), text);
+    std::fflush(output);
+}
+
+// Helper method to copy the first length bytes of the scratch file to output
+void EncodeService::copyScratch(unsigned long length, FILE* output) {
+    char buffer[512];
+
+    std::rewind(scratch);
+    while (length > 0) {
+        size_t count = length < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer);
+        if (std::fread(buffer, 1, count, scratch) != count) {
+            throw std::runtime_error("Error reading the temporary file.");
+        }
+        if (std::fwrite(buffer, 1, count, output) != count) {
+            throw std::runtime_error("Error writing the output file.");
+        }
+        length -= count;
+    }
+}
+
+// Helper method to write an error reply
+void EncodeService::writeError(const char* message, FILE* output) {
+    std::fprintf(output, "ERROR %s\n", message);
+    std::fflush(output);
+}
+
+// Helper method to convert clock ticks to milliseconds
+unsigned long EncodeService::toMillis(std::clock_t ticks) {
+    return static_cast<unsigned long>(ticks * 1000.0 / CLOCKS_PER_SEC);
+}
+}  // namespace qrserv
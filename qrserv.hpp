@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRSERV_HPP
+#define QRSERV_HPP
+
+#include <cstdio>
+#include <ctime>
+
+#include "charconv.hpp"
+
+namespace qrserv {
+
+/*
+ * This class serves encode requests from a byte stream until QUIT or the end of the input, so
+ * startup and initialization are paid only once for many QR codes. Requests and replies are
+ * framed with a header line, binary data follows with the length given in the header:
+ *
+ *   ENCODE <ecc L|M|Q|H> <min version> <max version> <mask -1..7> <PBM|SVG|PNG> <payload length>\n<payload>
+ *     -> OK <version> <ecc> <mask> <length>\n<PBM, SVG or PNG image>
+ *   STATS\n
+ *     -> OK <length>\n<metrics as text lines>
+ *   QUIT\n
+ *     -> OK 0\n
+ *
+ * A failed request is answered with ERROR <message>\n. An image that can not be sent in full after
+ * its OK header is fatal, as the stream would be out of sync. The payload is text in the codepage of
+ * the given converter. Any stream works, e.g. stdin/stdout attached to a pipe or local socket.
+ */
+class EncodeService {
+   public:
+    // Constructor to set the converter for the payload codepage, creates the scratch file
+    explicit EncodeService(const charconv::CharConverter& converter);
+
+    // Destructor to remove the scratch file
+    ~EncodeService();
+
+    // Method to serve requests from input until QUIT or the end of the input. Throws if an image
+    // can not be sent in full after its OK header, the stream is then out of sync and the service ends.
+    void run(FILE* input, FILE* output);
+
+   private:
+    // Converter for the codepage of the payloads
+    const charconv::CharConverter& converter;
+
+    // Temporary file that each image is rendered to once, so its length is known before it is sent.
+    // Images can exceed 64 KB, which is more than one memory block holds on DOS.
+    FILE* scratch;
+
+    // Metrics reported by STATS
+    unsigned long requests;
+    unsigned long failures;
+    unsigned long bytesIn;
+    unsigned long bytesOut;
+    unsigned long totalMillis;
+    unsigned long maxMillis;
+    std::clock_t started;
+
+    // Longest accepted header line and payload
+    static const int MAX_LINE = 128;
+    static const unsigned long MAX_PAYLOAD = 8192;
+
+    // Helper method to handle an ENCODE request with the arguments after the command
+    void handleEncode(const char* args, FILE* input, FILE* output);
+
+    // Helper method to answer a STATS request
+    void handleStats(FILE* output) const;
+
+    // Helper method to copy the first length bytes of the scratch file to output
+    void copyScratch(unsigned long length, FILE* output);
+
+    // Helper method to write an error reply
+    static void writeError(const char* message, FILE* output);
+
+    // Helper method to convert clock ticks to milliseconds
+    static unsigned long toMillis(std::clock_t ticks);
+
+    // Not copyable, the scratch file is owned by the service
+    EncodeService(const EncodeService&);
+    EncodeService& operator=(const EncodeService&);
+};
+}  // namespace qrserv
+
+#endif  // QRSERV_HPP
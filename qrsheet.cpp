@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrsheet.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using qrcodegen::QrCode;
+using qrimage::PngWriter;
+
+namespace qrsheet {
+// Helper function to set count pixels starting at pixel x of a packed row
+static void setPixels(uint8_t* row, int x, int count) {
+    int end = x + count;
+    if ((x >> 3) == (end >> 3)) {
+        row[x >> 3] |= static_cast<uint8_t>((0xFF >> (x & 7)) & ~(0xFF >> (end & 7)));
+        return;
+    }
+    row[x >> 3] |= static_cast<uint8_t>(0xFF >> (x & 7));
+    std::memset(row + (x >> 3) + 1, 0xFF, (end >> 3) - (x >> 3) - 1);
+    if (end & 7) {
+        row[end >> 3] |= static_cast<uint8_t>(~(0xFF >> (end & 7)));
+    }
+}
+
+// Constructor: Set the layout, all cells are empty
+SheetRenderer::SheetRenderer(int columns, int rows, int cellWidth, int cellHeight, int margin, int scale)
+    : columns(columns), rows(rows), cellWidth(cellWidth), cellHeight(cellHeight), margin(margin), scale(scale) {
+    if (columns < 1 || rows < 1 || cellWidth < 1 || cellHeight < 1 || margin < 0 || scale < 1) {
+        throw std::invalid_argument("Invalid sheet layout");
+    }
+    cells.resize(static_cast<size_t>(columns) * rows);
+}
+
+// Method to place a QR code in a cell
+void SheetRenderer::setCell(int column, int row, const QrCode& qr) {
+    if (column < 0 || column >= columns || row < 0 || row >= rows) {
+        throw std::out_of_range("Cell out of range");
+    }
+    int symbolSize = (qr.getSize() + 2 * BORDER) * scale;
+    if (symbolSize > cellWidth || symbolSize > cellHeight) {
+        throw std::invalid_argument("QR code does not fit into the cell");
+    }
+    cells[static_cast<size_t>(row) * columns + column] = qr;
+}
+
+// Method to get the page width in pixels
+int SheetRenderer::getWidth() const {
+    return 2 * margin + columns * cellWidth;
+}
+
+// Method to get the page height in pixels
+int SheetRenderer::getHeight() const {
+    return 2 * margin + rows * cellHeight;
+}
+
+// Method to get the number of bytes of a packed row of the page
+size_t SheetRenderer::getRowBytes() const {
+    return (static_cast<size_t>(getWidth()) + 7) / 8;
+}
+
+// Method to render a band of the page
+void SheetRenderer::renderBand(int y, int count, uint8_t* band, size_t stride) const {
+    const size_t rowBytes = getRowBytes();
+    for (int i = 0; i < count; i++) {
+        std::memset(band + stride * i, 0, rowBytes);
+    }
+
+    // Only the cell rows that overlap the band are visited
+    if (y + count <= margin) {
+        return;
+    }
+    int firstRow = y < margin ? 0 : (y - margin) / cellHeight;
+    int lastRow = (y + count - 1 - margin) / cellHeight;
+    if (lastRow >= rows) {
+        lastRow = rows - 1;
+    }
+
+    std::vector<uint8_t> modules;
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int column = 0; column < columns; column++) {
+            const QrCode& qr = cells[static_cast<size_t>(row) * columns + column];
+            if (qr.getSize() == 0) {
+                continue;
+            }
+
+            // The symbol with its quiet zone is centered in the cell
+            const int qrSize = qr.getSize() + 2 * BORDER;
+            const int symbolSize = qrSize * scale;
+            const int left = margin + column * cellWidth + (cellWidth - symbolSize) / 2;
+            const int top = margin + row * cellHeight + (cellHeight - symbolSize) / 2;
+
+            // Pixel rows of the symbol inside the band
+            int begin = y > top ? y : top;
+            int end = y + count < top + symbolSize ? y + count : top + symbolSize;
+            modules.resize(qr.getPackedLineBytes(BORDER));
+            int lastModuleRow = -1;
+            for (int py = begin; py < end; py++) {
+                int moduleRow = (py - top) / scale;
+                if (moduleRow != lastModuleRow) {
+                    qr.getRowBits(-BORDER, moduleRow - BORDER, qrSize, &modules[0]);
+                    lastModuleRow = moduleRow;
+                }
+                uint8_t* dest = band + stride * (py - y);
+                for (int x = 0; x < qrSize; x++) {
+                    if (modules[x >> 3] & (0x80 >> (x & 7))) {
+                        setPixels(dest, left + x * scale, scale);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Method to write the page as binary PBM (P4) image band by band
+void SheetRenderer::writePbm(FILE* output, int bandHeight) const {
+    char header[32];
+    qrimage::formatPbmHeader(getWidth(), getHeight(), header);
+    std::fputs(header, output);
+
+    const size_t rowBytes = getRowBytes();
+    if (bandHeight < 1) {
+        bandHeight = 1;
+    }
+    std::vector<uint8_t> band(rowBytes * bandHeight);
+    for (int y = 0; y < getHeight(); y += bandHeight) {
+        int count = getHeight() - y < bandHeight ? getHeight() - y : bandHeight;
+        renderBand(y, count, &band[0], rowBytes);
+        if (std::fwrite(&band[0], rowBytes, count, output) != static_cast<size_t>(count)) {
+            throw std::runtime_error("Error writing the output file.");
+        }
+    }
+}
+
+// Method to write the page as 1-bit grayscale PNG image band by band
+void SheetRenderer::writePng(FILE* output, PngWriter::Level level, int bandHeight) const {
+    PngWriter png(output, getWidth(), getHeight(), level);
+
+    const size_t rowBytes = getRowBytes();
+    if (bandHeight < 1) {
+        bandHeight = 1;
+    }
+    std::vector<uint8_t> band(rowBytes * bandHeight);
+    for (int y = 0; y < getHeight(); y += bandHeight) {
+        int count = getHeight() - y < bandHeight ? getHeight() - y : bandHeight;
+        renderBand(y, count, &band[0], rowBytes);
+        for (int i = 0; i < count; i++) {
+            png.writeRow(&band[rowBytes * i]);
+        }
+    }
+    png.finish();
+}
+}  // namespace qrsheet
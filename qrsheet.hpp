@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRSHEET_HPP
+#define QRSHEET_HPP
+
+#include <cstdio>
+#include <vector>
+
+#include "qrcodegen.hpp"
+#include "qrimage.hpp"
+
+namespace qrsheet {
+
+/*
+ * This class composes many QR codes on one page, e.g. a sheet of labels. The page is a grid of
+ * cells of equal size inside a margin, every QR code is centered in its cell with a border of
+ * 4 modules. The page is rendered as 1-bit raster one band of rows at a time, so the whole page
+ * is never held in memory. Bands are independent of each other.
+ */
+class SheetRenderer {
+   public:
+    // Constructor to set the grid of columns * rows cells of cellWidth * cellHeight pixels, the
+    // margin around the grid in pixels and the size of a module in pixels. All cells are empty.
+    SheetRenderer(int columns, int rows, int cellWidth, int cellHeight, int margin, int scale);
+
+    // Method to place a QR code in a cell, an empty QrCode clears the cell. Throws if the QR code
+    // including its border does not fit into the cell.
+    void setCell(int column, int row, const qrcodegen::QrCode& qr);
+
+    // Methods to get the page size in pixels and the number of bytes of a packed row
+    int getWidth() const;
+    int getHeight() const;
+    size_t getRowBytes() const;
+
+    // Method to render count rows of the page, starting at row y, into the given band. Rows are
+    // packed 8 pixels per byte, MSB first, 1 is black, and row i starts at band + i * stride.
+    void renderBand(int y, int count, uint8_t* band, size_t stride) const;
+
+    // Methods to write the page as binary PBM (P4) or 1-bit grayscale PNG image, rendered in
+    // bands of bandHeight rows
+    void writePbm(FILE* output, int bandHeight = 64) const;
+    void writePng(FILE* output, qrimage::PngWriter::Level level = qrimage::PngWriter::FAST, int bandHeight = 64) const;
+
+   private:
+    // Layout of the page
+    int columns;
+    int rows;
+    int cellWidth;
+    int cellHeight;
+    int margin;
+    int scale;
+
+    // QR codes of the cells row by row, they share their modules with the caller's copies
+    std::vector<qrcodegen::QrCode> cells;
+
+    // Border size in QR modules
+    static const int BORDER = 4;
+};
+}  // namespace qrsheet
+
+#endif  // QRSHEET_HPP
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrtext.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using qrcodegen::AllocationTracker;
+using qrcodegen::BitBuffer;
+using qrcodegen::QrCode;
+using qrcodegen::QrSegment;
+
+namespace qrtext {
+// Helper function to count the bytes of the UTF-8 conversion of a text without converting it. The text
+// is measured in slices whose conversion fits into a size_t, the total can exceed it on 16 bit targets.
+static long getConvertedLength(const char* text, const charconv::CharConverter& converter) {
+    const size_t SLICE_SIZE = 1024;
+    size_t length = std::strlen(text);
+    long numBytes = 0;
+    while (length > 0) {
+        size_t consumed;
+        numBytes += static_cast<long>(converter.convertChunk(text, std::min(length, SLICE_SIZE), NULL, 0, consumed));
+        text += consumed;
+        length -= consumed;
+    }
+    return numBytes;
+}
+
+// Helper function to get the byte segment for non-ASCII text in the codepage of the given converter
+static std::vector<QrSegment> makeConvertedSegments(const char* text, const charconv::CharConverter& converter) {
+    // Convert small chunks and append their bytes right away
+    BitBuffer bb;
+    size_t length = std::strlen(text);
+    long numBytes = 0;
+    char chunk[64];
+    while (length > 0) {
+        size_t consumed;
+        size_t produced = converter.convertChunk(text, length, chunk, sizeof(chunk), consumed);
+        for (size_t i = 0; i < produced; i++) {
+            bb.appendBits(static_cast<uint8_t>(chunk[i]), 8);
+        }
+        numBytes += static_cast<long>(produced);
+        text += consumed;
+        length -= consumed;
+    }
+    if (numBytes > INT_MAX) {
+        throw std::length_error("Data too long");
+    }
+
+    // The segment takes the bits by swapping, and is swapped into the list to avoid copying them again
+    QrSegment segment(QrSegment::Mode::BYTE, static_cast<int>(numBytes), bb);
+    std::vector<QrSegment> result;
+    result.push_back(QrSegment());
+    result.back().swap(segment);
+    return result;
+}
+
+// Function to get the segments for a text in the codepage of the given converter
+std::vector<QrSegment> makeSegments(const char* text, const charconv::CharConverter& converter) {
+    // ASCII text is the same in every codepage and in UTF-8, one pass finds that and its mode
+    long numChars;
+    bool ascii;
+    const QrSegment::Mode* md = QrSegment::classifyText(text, numChars, ascii);
+    if (ascii) {
+        return QrSegment::makeSegments(text, md);
+    }
+    return makeConvertedSegments(text, converter);
+}
+
+// Function to get the ECI segments for a text in the codepage of the given converter
+std::vector<QrSegment> makeEciSegments(const char* text, const charconv::CharConverter& converter) {
+    std::vector<QrSegment> result;
+    std::vector<uint8_t> data;
+    long assignVal = converter.convertToEci(text, data);
+    if (assignVal != -1) {
+        result.push_back(QrSegment::makeEci(assignVal));
+        result.push_back(QrSegment::makeBytes(data));
+    }
+    return result;
+}
+
+// Function to encode a text in the codepage of the given converter
+QrCode::Status tryEncodeText(const char* text, const charconv::CharConverter& converter, QrCode::Ecc ecl,
+                             QrCode& result, QrCode::Capacity& capacity, bool allowEci) {
+    AllocationTracker::StageGuard stage(AllocationTracker::SEGMENTS);
+
+    // ASCII text is encoded like UTF-8 text, the capacity is checked before any segment is built
+    long numChars;
+    bool ascii;
+    const QrSegment::Mode* md = QrSegment::classifyText(text, numChars, ascii);
+    if (ascii) {
+        capacity = QrCode::planSegment(md, numChars, ecl);
+        if (capacity.version == -1) {
+            return capacity.usedBits == -1 ? QrCode::SEGMENT_TOO_LONG : QrCode::DATA_TOO_LONG;
+        }
+        const std::vector<QrSegment> segs = QrSegment::makeSegments(text, md);
+        return QrCode::tryEncodeSegments(segs, ecl, result, capacity);
+    }
+
+    // Non-ASCII text is planned on the length of its UTF-8 conversion before any segment is built
+    QrCode::Capacity utf8Capacity = QrCode::planSegment(&QrSegment::Mode::BYTE, getConvertedLength(text, converter), ecl);
+
+    // The ECI encoding wins only with a smaller version, as UTF-8 is understood by more readers
+    if (allowEci) {
+        const std::vector<QrSegment> eciSegs = makeEciSegments(text, converter);
+        if (!eciSegs.empty()) {
+            QrCode::Capacity eciCapacity = QrCode::planSegments(eciSegs, ecl);
+            if (eciCapacity.version != -1 && (utf8Capacity.version == -1 || eciCapacity.version < utf8Capacity.version)) {
+                return QrCode::tryEncodeSegments(eciSegs, ecl, result, capacity);
+            }
+        }
+    }
+
+    capacity = utf8Capacity;
+    if (capacity.version == -1) {
+        return capacity.usedBits == -1 ? QrCode::SEGMENT_TOO_LONG : QrCode::DATA_TOO_LONG;
+    }
+    const std::vector<QrSegment> segs = makeConvertedSegments(text, converter);
+    return QrCode::tryEncodeSegments(segs, ecl, result, capacity);
+}
+
+// Function to encode a text in the codepage of the given converter, throwing on failure
+QrCode encodeText(const char* text, const charconv::CharConverter& converter, QrCode::Ecc ecl, bool allowEci) {
+    QrCode result;
+    QrCode::Capacity capacity;
+    QrCode::Status status = tryEncodeText(text, converter, ecl, result, capacity, allowEci);
+    if (status == QrCode::INVALID_ARGUMENT) {
+        throw std::invalid_argument(QrCode::getStatusMessage(status, capacity));
+    } else if (status != QrCode::SUCCESS) {
+        throw qrcodegen::data_too_long(QrCode::getStatusMessage(status, capacity));
+    }
+    return result;
+}
+}  // namespace qrtext
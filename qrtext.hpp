@@ -0,0 +1,57 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRTEXT_HPP
+#define QRTEXT_HPP
+
+#include <vector>
+
+#include "charconv.hpp"
+#include "qrcodegen.hpp"
+
+namespace qrtext {
+
+// Function to get the segments for a text in the codepage of the given converter, the same as
+// QrSegment::makeSegments returns for its UTF-8 conversion. Non-ASCII text is converted in small
+// chunks whose bytes are appended straight to the bit buffer, without an intermediate UTF-8 string.
+std::vector<qrcodegen::QrSegment> makeSegments(const char* text, const charconv::CharConverter& converter);
+
+// Function to get an ECI designator segment followed by a byte segment for a text in the codepage of
+// the given converter, in the first single byte charset that has all of its characters (see
+// CharConverter::convertToEci). Returns an empty list if no such charset has all characters.
+std::vector<qrcodegen::QrSegment> makeEciSegments(const char* text, const charconv::CharConverter& converter);
+
+// Function to encode a text in the codepage of the given converter like QrCode::tryEncodeText encodes
+// its UTF-8 conversion. If allowEci is true, non-ASCII text is also tried with makeEciSegments and that
+// encoding is used if it gives a smaller version. Not every reader supports ECI.
+qrcodegen::QrCode::Status tryEncodeText(const char* text, const charconv::CharConverter& converter,
+                                        qrcodegen::QrCode::Ecc ecl, qrcodegen::QrCode& result,
+                                        qrcodegen::QrCode::Capacity& capacity, bool allowEci = false);
+
+// Function to do the same as tryEncodeText, throwing the exceptions of QrCode::encodeText on failure
+qrcodegen::QrCode encodeText(const char* text, const charconv::CharConverter& converter,
+                             qrcodegen::QrCode::Ecc ecl, bool allowEci = false);
+}  // namespace qrtext
+
+#endif  // QRTEXT_HPP
@@ -0,0 +1,57 @@
+/*
+ * Test that the allocation stage of the encoder is restored after every encode,
+ * also after rejected and failed ones. Returns a nonzero exit code on failure.
+ */
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "qrcodegen.hpp"
+
+using qrcodegen::AllocationTracker;
+using qrcodegen::QrCode;
+using qrcodegen::QrSegment;
+
+static int failed = 0;
+
+// Helper function to report a stage other than OTHER after an encode
+static void checkStage(const AllocationTracker& tracker, const char* name) {
+    if (tracker.getStage() != AllocationTracker::OTHER) {
+        std::printf("FAIL %s: stage %d\n", name, static_cast<int>(tracker.getStage()));
+        failed++;
+    } else {
+        std::printf("ok   %s\n", name);
+    }
+}
+
+int main() {
+    AllocationTracker tracker;
+    QrCode qr;
+    QrCode::Capacity capacity;
+
+    QrCode::tryEncodeText("HELLO WORLD", QrCode::LOW, qr, capacity);
+    checkStage(tracker, "successful encode");
+
+    std::string tooLong(4000, 'x');
+    QrCode::tryEncodeText(tooLong.c_str(), QrCode::HIGH, qr, capacity);
+    checkStage(tracker, "text too long");
+
+    std::vector<QrSegment> segs = QrSegment::makeSegments(tooLong.c_str());
+    QrCode::tryEncodeSegments(segs, QrCode::HIGH, qr, capacity);
+    checkStage(tracker, "segments too long");
+
+    segs = QrSegment::makeSegments("HELLO");
+    QrCode::tryEncodeSegments(segs, QrCode::LOW, qr, capacity, 1, 40, 9);
+    checkStage(tracker, "invalid mask");
+
+    try {
+        QrCode::encodeSegments(segs, QrCode::LOW, 1, 1, -1);
+        QrCode::encodeText(tooLong.c_str(), QrCode::LOW);
+    } catch (const std::exception&) {
+    }
+    checkStage(tracker, "thrown exception");
+
+    return failed == 0 ? 0 : 1;
+}
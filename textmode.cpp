@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "textmode.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using qrcodegen::QrCode;
+
+namespace textmode {
+// Constructor: Set the screen size and drawing attribute
+TextRenderer::TextRenderer(int columns, int rows, uint8_t attribute) : columns(columns), rows(rows), attribute(attribute) {
+}
+
+// Method to check if the QR code including its border fits on the screen
+bool TextRenderer::fits(const QrCode& qr) const {
+    const int qrSize = qr.getSize() + 2 * BORDER;  // QR code size including border (in modules)
+    const int cellRows = (qrSize + 1) / 2;          // Two modules per character cell
+
+    return qrSize <= columns && cellRows <= rows;
+}
+
+// Method to render the centered QR code into the given screen buffer
+void TextRenderer::render(const QrCode& qr, uint16_t* screen) const {
+    if (!fits(qr)) {
+        throw std::runtime_error("QR code is too large to fit on the screen.");
+    }
+
+    const int qrSize = qr.getSize() + 2 * BORDER;  // QR code size including border (in modules)
+    const int cellRows = (qrSize + 1) / 2;          // Two modules per character cell
+
+    // Calculate the starting cell to center the QR code
+    const int startX = (columns - qrSize) / 2;
+    const int startY = (rows - cellRows) / 2;
+
+    const uint16_t attr = static_cast<uint16_t>(attribute) << 8;
+
+    // Packed module rows (including border) in the upper and lower half of the current cell row
+    std::vector<uint8_t> upperRow(qr.getPackedLineBytes(BORDER));
+    std::vector<uint8_t> lowerRow(upperRow.size());
+
+    // Write the screen row by row, cells outside of the QR code are left blank
+    uint16_t* cell = screen;
+    for (int row = 0; row < rows; row++) {
+        const int yTop = (row - startY) * 2;  // Module row in the upper half of the cell (including border)
+        const bool inRows = (row >= startY && row < startY + cellRows);
+
+        if (inRows) {
+            // There is no module row below an odd sized code, it is filled as dark so that
+            // the lower half of the cell is left in the background color
+            qr.getRowBits(-BORDER, yTop - BORDER, qrSize, &upperRow[0]);
+            qr.getRowBits(-BORDER, yTop + 1 - BORDER, qrSize, &lowerRow[0]);
+            if (yTop + 1 >= qrSize) {
+                std::fill(lowerRow.begin(), lowerRow.end(), 0xFF);
+            }
+        }
+
+        for (int col = 0; col < columns; col++) {
+            uint8_t glyph = GLYPH_NONE;
+            const int x = col - startX;  // Module column (including border)
+
+            if (inRows && x >= 0 && x < qrSize) {
+                // Light modules are drawn in the foreground color
+                const uint8_t bit = 0x80 >> (x & 7);
+                const bool upper = (upperRow[x >> 3] & bit) == 0;
+                const bool lower = (lowerRow[x >> 3] & bit) == 0;
+
+                if (upper && lower)
+                    glyph = GLYPH_FULL;
+                else if (upper)
+                    glyph = GLYPH_UPPER;
+                else if (lower)
+                    glyph = GLYPH_LOWER;
+            }
+            *cell++ = attr | glyph;
+        }
+    }
+}
+}  // namespace textmode
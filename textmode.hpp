@@ -0,0 +1,72 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) ccharon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEXTMODE_HPP
+#define TEXTMODE_HPP
+
+#include <cstdint>
+
+#include "qrcodegen.hpp"
+
+namespace textmode {
+
+/*
+ * This class renders a QR Code into a color text mode screen buffer (80x25, 80x50, ...).
+ * Every character cell holds two vertically stacked modules drawn with the CP437 half block
+ * glyphs, so no switch to a graphics mode is needed. The screen buffer is a sequence of
+ * character/attribute words, row by row, as found in text VRAM at B800:0000. Any other
+ * buffer of columns * rows words can be used as well.
+ */
+class TextRenderer {
+   public:
+    // Constructor to set the screen size in character cells and the attribute used for drawing
+    // (the foreground color draws the light modules, the background color the dark ones)
+    explicit TextRenderer(int columns = 80, int rows = 25, uint8_t attribute = 0x0F);
+
+    // Method to check if the QR code including its border fits on the screen
+    bool fits(const qrcodegen::QrCode& qr) const;
+
+    // Method to render the centered QR code into the given screen buffer of columns * rows words
+    void render(const qrcodegen::QrCode& qr, uint16_t* screen) const;
+
+   private:
+    // Screen size in character cells
+    int columns;
+    int rows;
+
+    // Attribute byte written with every character
+    uint8_t attribute;
+
+    // Border size in QR modules
+    static const int BORDER = 4;
+
+    // CP437 glyphs for the four combinations of two stacked modules
+    static const uint8_t GLYPH_NONE = 0x20;
+    static const uint8_t GLYPH_UPPER = 0xDF;
+    static const uint8_t GLYPH_LOWER = 0xDC;
+    static const uint8_t GLYPH_FULL = 0xDB;
+};
+}  // namespace textmode
+
+#endif  // TEXTMODE_HPP